@@ -0,0 +1,125 @@
+/**
+ * time to clear a timeline buffer of 1k/10k statuses.
+ *
+ * "tags" is the old way: one anonymous tag per link holding its payload,
+ * released by walking the deleted range one character at a time.
+ * "linkstore" is shared tags with payloads in per-render tables.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <gtk/gtk.h>
+#include "linkstore.h"
+
+#define STATUSES_PER_RENDER 20
+
+static const char* sample_text = "reading http://example.com/a/long/path?with=query and @someone says >>1234567 ";
+
+static void tags_delete_range(GtkTextBuffer* buffer, GtkTextIter* start, GtkTextIter* end, gpointer user_data) {
+	static const char* keys[] = { "url", "user_id", "user_name", "user_description" };
+	GtkTextIter* iter = gtk_text_iter_copy(end);
+	while(iter) {
+		GSList* tags;
+		GSList* item;
+		int n;
+		if (!gtk_text_iter_backward_char(iter)) break;
+		if (!gtk_text_iter_in_range(iter, start, end)) break;
+		tags = gtk_text_iter_get_tags(iter);
+		for(item = tags; item; item = item->next) {
+			for(n = 0; n < 4; n++) {
+				gpointer data = g_object_get_data(G_OBJECT(item->data), keys[n]);
+				if (data) g_free(data);
+				g_object_set_data(G_OBJECT(item->data), keys[n], NULL);
+			}
+		}
+		g_slist_free(tags);
+	}
+	gtk_text_iter_free(iter);
+}
+
+static GtkTextTag* payload_tag(GtkTextBuffer* buffer, const char* key, const char* value) {
+	GtkTextTag* tag = gtk_text_buffer_create_tag(buffer, NULL, "underline", PANGO_UNDERLINE_SINGLE, NULL);
+	g_object_set_data(G_OBJECT(tag), key, g_strdup(value));
+	return tag;
+}
+
+static double bench_tags(int count) {
+	GtkTextBuffer* buffer = gtk_text_buffer_new(NULL);
+	GtkTextIter iter;
+	GTimer* timer;
+	double elapsed;
+	int n;
+
+	g_signal_connect(G_OBJECT(buffer), "delete-range", G_CALLBACK(tags_delete_range), NULL);
+	gtk_text_buffer_get_end_iter(buffer, &iter);
+	for(n = 0; n < count; n++) {
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "someone", -1, payload_tag(buffer, "user_id", "someone"), NULL);
+		gtk_text_buffer_insert(buffer, &iter, " (Some One)\n", -1);
+		gtk_text_buffer_insert(buffer, &iter, sample_text, -1);
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "http://example.com/", -1, payload_tag(buffer, "url", "http://example.com/"), NULL);
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "@other", -1, payload_tag(buffer, "user_name", "other"), NULL);
+		gtk_text_buffer_insert(buffer, &iter, "\nSat Jan 01 00:00:00 +0000 2000\n\n", -1);
+	}
+
+	timer = g_timer_new();
+	gtk_text_buffer_set_text(buffer, "", 0);
+	elapsed = g_timer_elapsed(timer, NULL);
+	g_timer_destroy(timer);
+	g_object_unref(buffer);
+	return elapsed;
+}
+
+static double bench_linkstore(int count) {
+	GtkTextBuffer* buffer = gtk_text_buffer_new(NULL);
+	GtkTextTag* link_tag = gtk_text_buffer_create_tag(buffer, "link_tag", "underline", PANGO_UNDERLINE_SINGLE, NULL);
+	LINK_STORE* store = link_store_new(buffer);
+	LINK_RENDER* render = NULL;
+	GtkTextIter iter;
+	GTimer* timer;
+	double elapsed;
+	int n, start;
+
+	gtk_text_buffer_get_end_iter(buffer, &iter);
+	for(n = 0; n < count; n++) {
+		if (n % STATUSES_PER_RENDER == 0) {
+			if (render) link_store_commit(store, render);
+			render = link_store_begin(store, gtk_text_iter_get_offset(&iter));
+		}
+		link_render_add_status(render, gtk_text_iter_get_offset(&iter));
+		start = gtk_text_iter_get_offset(&iter);
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "someone", -1, link_tag, NULL);
+		link_render_add(render, start, gtk_text_iter_get_offset(&iter), NULL, "someone", "someone", NULL);
+		gtk_text_buffer_insert(buffer, &iter, " (Some One)\n", -1);
+		gtk_text_buffer_insert(buffer, &iter, sample_text, -1);
+		start = gtk_text_iter_get_offset(&iter);
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "http://example.com/", -1, link_tag, NULL);
+		link_render_add(render, start, gtk_text_iter_get_offset(&iter), "http://example.com/", NULL, NULL, NULL);
+		start = gtk_text_iter_get_offset(&iter);
+		gtk_text_buffer_insert_with_tags(buffer, &iter, "@other", -1, link_tag, NULL);
+		link_render_add(render, start, gtk_text_iter_get_offset(&iter), NULL, "other", "other", NULL);
+		gtk_text_buffer_insert(buffer, &iter, "\nSat Jan 01 00:00:00 +0000 2000\n\n", -1);
+	}
+	if (render) link_store_commit(store, render);
+
+	timer = g_timer_new();
+	gtk_text_buffer_set_text(buffer, "", 0);
+	elapsed = g_timer_elapsed(timer, NULL);
+	g_timer_destroy(timer);
+	link_store_free(store);
+	g_object_unref(buffer);
+	return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+	static const int counts[] = { 1000, 10000 };
+	int n;
+
+	/* the text buffer needs no display */
+	gtk_init_check(&argc, &argv);
+
+	printf("%-10s %8s %12s\n", "clear", "statuses", "msec");
+	for(n = 0; n < 2; n++) {
+		printf("%-10s %8d %12.2f\n", "tags", counts[n], bench_tags(counts[n])*1000);
+		printf("%-10s %8d %12.2f\n", "linkstore", counts[n], bench_linkstore(counts[n])*1000);
+	}
+	return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * throughput of decoding entity heavy text.
+ *
+ * "old" is xml_decode_alloc as it was in gtktwitter.c: three times the
+ * input zero filled, and each entity compared in turn at every byte.
+ * "alloc" and "inplace" are entity.c.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include "entity.h"
+
+#define TOTAL_BYTES  (32*1024*1024)
+#define ROUNDS       5
+
+static const char* sample =
+	"&lt;a href=&quot;http://example.com/?a=1&amp;b=2&quot;&gt;Tom &amp; Jerry&lt;/a&gt; "
+	"&quot;\xe3\x81\x8a\xe3\x81\xaf\xe3\x82\x88\xe3\x81\x86&quot; &lt;3 &gt;_&lt; ";
+
+static char* xml_decode_alloc(const char* str) {
+	char* buf = NULL;
+	unsigned char* pbuf = NULL;
+	int len = 0;
+
+	if (!str) return NULL;
+	len = strlen(str)*3;
+	buf = malloc(len+1);
+	memset(buf, 0, len+1);
+	pbuf = (unsigned char*)buf;
+	while(*str) {
+		if (*str == '<') {
+			char* ptr = strchr(str, '>');
+			if (ptr) str = ptr + 1;
+		} else
+		if (!memcmp(str, "&amp;", 5)) {
+			strcat((char*)pbuf++, "&");
+			str += 5;
+		} else
+		if (!memcmp(str, "&nbsp;", 6)) {
+			strcat((char*)pbuf++, " ");
+			str += 6;
+		} else
+		if (!memcmp(str, "&quot;", 6)) {
+			strcat((char*)pbuf++, "\"");
+			str += 6;
+		} else
+		if (!memcmp(str, "&nbsp;", 6)) {
+			strcat((char*)pbuf++, " ");
+			str += 6;
+		} else
+		if (!memcmp(str, "&lt;", 4)) {
+			strcat((char*)pbuf++, "<");
+			str += 4;
+		} else
+		if (!memcmp(str, "&gt;", 4)) {
+			strcat((char*)pbuf++, ">");
+			str += 4;
+		} else
+			*pbuf++ = *str++;
+	}
+	return buf;
+}
+
+/**
+ * count texts of size bytes each, made of the sample.
+ */
+static char** make_texts(size_t size, int count) {
+	char** texts = malloc(count*sizeof(char*));
+	size_t sample_len = strlen(sample);
+	int n;
+
+	for(n = 0; n < count; n++) {
+		size_t len = 0;
+		texts[n] = malloc(size+1);
+		while(len + sample_len <= size) {
+			memcpy(texts[n] + len, sample, sample_len);
+			len += sample_len;
+		}
+		texts[n][len] = 0;
+	}
+	return texts;
+}
+
+static double bench(char** texts, char** work, int count, int kind) {
+	GTimer* timer;
+	double elapsed;
+	int n;
+
+	if (kind == 2)
+		for(n = 0; n < count; n++) strcpy(work[n], texts[n]);
+	timer = g_timer_new();
+	for(n = 0; n < count; n++) {
+		if (kind == 0)
+			free(xml_decode_alloc(texts[n]));
+		else
+		if (kind == 1)
+			free(entity_decode_alloc(texts[n], ENTITY_STRIP_MARKUP));
+		else
+			entity_decode(work[n], ENTITY_STRIP_MARKUP);
+	}
+	elapsed = g_timer_elapsed(timer, NULL);
+	g_timer_destroy(timer);
+	return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+	static const size_t sizes[] = { 140, 1024, 64*1024 };
+	static const char* kinds[] = { "old", "alloc", "inplace" };
+	int s, k;
+
+	printf("%-8s %8s %10s %10s\n", "decoder", "bytes", "msec", "MB/s");
+	for(s = 0; s < 3; s++) {
+		int count = (int)(TOTAL_BYTES / sizes[s]);
+		char** texts = make_texts(sizes[s], count);
+		char** work = make_texts(sizes[s], count);
+		size_t bytes = strlen(texts[0]) * count;
+		int n;
+		for(k = 0; k < 3; k++) {
+			double best = 0;
+			int round;
+			for(round = 0; round < ROUNDS; round++) {
+				double elapsed = bench(texts, work, count, k);
+				if (!round || elapsed < best) best = elapsed;
+			}
+			printf("%-8s %8u %10.2f %10.1f\n", kinds[k], (unsigned)sizes[s], best*1000, bytes / best / (1024*1024));
+		}
+		for(n = 0; n < count; n++) {
+			free(texts[n]);
+			free(work[n]);
+		}
+		free(texts);
+		free(work);
+	}
+	return 0;
+}
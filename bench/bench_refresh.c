@@ -0,0 +1,211 @@
+/**
+ * refresh cycles of the timeline against bench_server.
+ *
+ * gtktwitter.c is built in with its main renamed and SERVICE_ROOT_URL
+ * pointing at the stand-in server. the window is built as the application
+ * does but never shown, and update_friends_statuses_thread runs as the
+ * reload timer would run it: the first cycle loads the whole timeline with
+ * empty caches, the others fetch what is new since the last one.
+ *
+ *   bench_refresh [--cycles 50] [--full] [--list] [--cache dir]
+ *
+ * --full loads the whole timeline every cycle, --list renders to the list
+ * view. caches are kept under dir, which should be empty. gtk needs a
+ * display, "make bench" uses xvfb-run when there is none.
+ *
+ * allocations are counted by wrapping malloc, calloc, realloc of NULL,
+ * memalign, posix_memalign, aligned_alloc and valloc of glibc, with g_slice
+ * told to use malloc, so those of glib, gtk, libxml2 and libcurl are
+ * included. strdup and the like of glibc call malloc inside the library
+ * and are not seen, nor is memory taken by mmap directly.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#define main gtktwitter_main
+#include "gtktwitter.c"
+#undef main
+
+#define DEFAULT_CYCLES  50
+#define DEFAULT_CACHE   "bench-cache"
+
+#ifdef __GLIBC__
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+extern void* __libc_memalign(size_t alignment, size_t size);
+extern void* __libc_valloc(size_t size);
+
+static volatile unsigned long allocations = 0;
+
+void* malloc(size_t size) {
+	__sync_fetch_and_add(&allocations, 1);
+	return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+	__sync_fetch_and_add(&allocations, 1);
+	return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+	if (!ptr) __sync_fetch_and_add(&allocations, 1);
+	return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+	__sync_fetch_and_add(&allocations, 1);
+	return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+	__sync_fetch_and_add(&allocations, 1);
+	return __libc_memalign(alignment, size);
+}
+
+void* valloc(size_t size) {
+	__sync_fetch_and_add(&allocations, 1);
+	return __libc_valloc(size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) {
+	void* mem;
+
+	if (alignment % sizeof(void*) || (alignment & (alignment - 1)))
+		return EINVAL;
+	__sync_fetch_and_add(&allocations, 1);
+	mem = __libc_memalign(alignment, size);
+	if (!mem && size) return ENOMEM;
+	*ptr = mem;
+	return 0;
+}
+# define ALLOCATIONS() allocations
+#else
+# define ALLOCATIONS() 0
+#endif
+
+typedef struct _CYCLE {
+	double msec;
+	guint64 wire_bytes;
+	guint64 decoded_bytes;
+	unsigned long allocations;
+} CYCLE;
+
+static int compare_double(const void* a, const void* b) {
+	double x = *(const double*)a, y = *(const double*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+/**
+ * one line of the report over count cycles.
+ */
+static void report(const char* name, CYCLE* cycles, int count) {
+	double* msec = malloc(count*sizeof(double));
+	guint64 wire_bytes = 0, decoded_bytes = 0;
+	unsigned long allocs = 0;
+	int n;
+
+	for(n = 0; n < count; n++) {
+		msec[n] = cycles[n].msec;
+		wire_bytes += cycles[n].wire_bytes;
+		decoded_bytes += cycles[n].decoded_bytes;
+		allocs += cycles[n].allocations;
+	}
+	qsort(msec, count, sizeof(double), compare_double);
+	printf("%-6s %6d %10.2f %10.2f %12lu %12lu %10lu\n", name, count,
+		msec[(count-1)*50/100], msec[(count-1)*99/100],
+		(unsigned long)(wire_bytes / count), (unsigned long)(decoded_bytes / count), allocs / count);
+	free(msec);
+}
+
+int main(int argc, char* argv[]) {
+	const char* cachedir = DEFAULT_CACHE;
+	int count = DEFAULT_CYCLES;
+	gboolean full = FALSE;
+	GtkWidget* window;
+	CYCLE* cycles;
+	GTimer* timer;
+	int n;
+
+	for(n = 1; n < argc; n++) {
+		if (!strcmp(argv[n], "--cycles") && n + 1 < argc) count = atoi(argv[++n]);
+		else if (!strcmp(argv[n], "--cache") && n + 1 < argc) cachedir = argv[++n];
+		else if (!strcmp(argv[n], "--full")) full = TRUE;
+		else if (!strcmp(argv[n], "--list")) use_status_view = TRUE;
+		else {
+			fprintf(stderr, "usage: %s [--cycles n] [--full] [--list] [--cache dir]\n", argv[0]);
+			return 1;
+		}
+	}
+	if (count < 2) count = 2;
+
+	/* every allocation goes through malloc */
+	g_setenv("G_SLICE", "always-malloc", TRUE);
+	g_thread_init(NULL);
+	gdk_threads_init();
+	if (!gtk_init_check(&argc, &argv)) {
+		fprintf(stderr, "bench_refresh: can't open display. run it under xvfb-run\n");
+		return 1;
+	}
+
+	http_engine_init(APP_NAME);
+	open_caches(cachedir);
+	init_icon_memory();
+	status_index = status_index_new();
+
+	/* built as main does, never shown */
+	window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+	gtk_container_add(GTK_CONTAINER(window), create_timeline_view(window));
+	g_object_set_data(G_OBJECT(window), "mail", strdup("bench"));
+	g_object_set_data(G_OBJECT(window), "pass", strdup("bench"));
+
+	printf("%s, %s refresh, %s view\n", SERVICE_SELF_STATUS_URL,
+		full ? "full" : "incremental", use_status_view ? "list" : "text");
+	cycles = malloc(count*sizeof(CYCLE));
+	timer = g_timer_new();
+	for(n = 0; n < count; n++) {
+		guint64 wire_before, decoded_before, wire_after, decoded_after;
+		unsigned long allocations_before;
+		gpointer result;
+
+		if (full) since_id[0] = 0;
+		http_get_transfer_stats(&wire_before, &decoded_before);
+		allocations_before = ALLOCATIONS();
+		g_timer_start(timer);
+
+		result = update_friends_statuses_thread(window);
+
+		cycles[n].msec = g_timer_elapsed(timer, NULL) * 1000;
+		cycles[n].allocations = ALLOCATIONS() - allocations_before;
+		http_get_transfer_stats(&wire_after, &decoded_after);
+		cycles[n].wire_bytes = wire_after - wire_before;
+		cycles[n].decoded_bytes = decoded_after - decoded_before;
+		if (result) {
+			fprintf(stderr, "bench_refresh: cycle %d: %s\n", n, (char*)result);
+			return 1;
+		}
+
+		/* what the main loop would do between two refreshes */
+		gdk_threads_enter();
+		while(gtk_events_pending())
+			gtk_main_iteration();
+		gdk_threads_leave();
+	}
+	g_timer_destroy(timer);
+
+	printf("%-6s %6s %10s %10s %12s %12s %10s\n", "cycle", "count", "p50 msec", "p99 msec", "wire bytes", "body bytes", "allocs");
+	report("cold", cycles, 1);
+	report("warm", cycles + 1, count - 1);
+#ifndef __GLIBC__
+	printf("(allocations are counted with glibc only)\n");
+#endif
+
+	free(cycles);
+	gtk_widget_destroy(window);
+	status_index_free(status_index);
+	term_icon_memory();
+	close_caches();
+	http_engine_cleanup();
+	return 0;
+}
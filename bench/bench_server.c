@@ -0,0 +1,452 @@
+/**
+ * stand-in of the api server for bench_refresh.
+ *
+ * answers "statuses/...xml" with synthetic timelines, or with the files of a
+ * recorded directory, and "icons/...png" with one image. every timeline
+ * request makes some new statuses first, so incremental refreshes always
+ * have something to fetch. latency and bandwidth of the link can be set.
+ *
+ *   bench_server [--port 8931] [--statuses 20] [--new 5] [--users 50]
+ *                [--latency msec] [--bandwidth bytes/sec]
+ *                [--icon ../data/logo.png] [--replay dir]
+ *
+ * with --replay, "GET /statuses/friends_timeline.xml" is answered with
+ * dir/statuses/friends_timeline.xml when it is there.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define REQUEST_MAX      16384
+#define STATUSES_MAX     200
+#define FIRST_STATUS_ID  1000000
+
+static int port = 8931;
+static int page_statuses = 20;
+static int new_statuses = 5;
+static int users = 50;
+static int latency = 0;
+static long bandwidth = 0;
+static const char* icon_path = "../data/logo.png";
+static const char* replay_dir = NULL;
+
+static char* icon_data = NULL;
+static size_t icon_size = 0;
+
+/* statuses made so far. ids are FIRST_STATUS_ID + index */
+static pthread_mutex_t timeline_lock = PTHREAD_MUTEX_INITIALIZER;
+static time_t* created = NULL;
+static long status_count = 0;
+
+static const char* samples[] = {
+	"just setting up my twttr",
+	"reading http://example.com/2009/01/some-long-article-name?ref=rss and it's good",
+	"@user1 thanks! I'll try the new build tonight",
+	"\xe4\xbb\x8a\xe6\x97\xa5\xe3\x81\xaf\xe3\x81\x84\xe3\x81\x84\xe5\xa4\xa9\xe6\xb0\x97\xe3\x81\xa0\xe3\x81\xad\xe3\x80\x82",
+	"\xef\xbc\xa0user2 \xe3\x81\x82\xe3\x82\x8a\xe3\x81\x8c\xe3\x81\xa8\xe3\x81\x86 http://d.hatena.ne.jp/mattn/20090101/1230796800",
+	">>1000123 &lt;3 &quot;Tom &amp; Jerry&quot; &gt;_&lt;",
+	"RT @user3: ftp://ftp.example.org/pub/release-1.0.tar.gz is out",
+	"lunch with @user4 @user5 and @user6. http://tinyurl.com/abc123 http://tinyurl.com/def456",
+};
+
+/**
+ * output buffer
+ */
+typedef struct _BUFFER {
+	char* data;
+	size_t size;
+	size_t capacity;
+} BUFFER;
+
+static void buffer_append(BUFFER* buf, const char* data, size_t size) {
+	if (buf->size + size + 1 > buf->capacity) {
+		while(buf->size + size + 1 > buf->capacity)
+			buf->capacity = buf->capacity ? buf->capacity*2 : 4096;
+		buf->data = realloc(buf->data, buf->capacity);
+	}
+	memcpy(buf->data + buf->size, data, size);
+	buf->size += size;
+	buf->data[buf->size] = 0;
+}
+
+static void buffer_printf(BUFFER* buf, const char* format, ...) {
+	char line[4096];
+	va_list args;
+	int len;
+
+	va_start(args, format);
+	len = vsnprintf(line, sizeof(line), format, args);
+	va_end(args);
+	if (len >= (int)sizeof(line)) len = sizeof(line)-1;
+	buffer_append(buf, line, len);
+}
+
+static void buffer_append_xml(BUFFER* buf, const char* text) {
+	for(; *text; text++) {
+		if (*text == '&') buffer_append(buf, "&amp;", 5);
+		else if (*text == '<') buffer_append(buf, "&lt;", 4);
+		else if (*text == '>') buffer_append(buf, "&gt;", 4);
+		else buffer_append(buf, text, 1);
+	}
+}
+
+/**
+ * synthetic timeline
+ */
+static void make_statuses(int count, time_t now) {
+	int n;
+	created = realloc(created, (status_count + count)*sizeof(time_t));
+	for(n = 0; n < count; n++)
+		created[status_count++] = now;
+}
+
+static void append_status(BUFFER* buf, const char* host, long index, const char* text) {
+	char date[64];
+	struct tm tm;
+	long id = FIRST_STATUS_ID + index;
+	int user = (int)(index % users);
+
+	gmtime_r(&created[index], &tm);
+	strftime(date, sizeof(date), "%a %b %d %H:%M:%S +0000 %Y", &tm);
+	buffer_printf(buf,
+		"<status>\n"
+		"  <created_at>%s</created_at>\n"
+		"  <id>%ld</id>\n"
+		"  <text>", date, id);
+	buffer_append_xml(buf, text ? text : samples[index % (sizeof(samples)/sizeof(samples[0]))]);
+	buffer_printf(buf,
+		"</text>\n"
+		"  <source>web</source>\n"
+		"  <truncated>false</truncated>\n"
+		"  <user>\n"
+		"    <id>%d</id>\n"
+		"    <name>User %d</name>\n"
+		"    <screen_name>user%d</screen_name>\n"
+		"    <description>stand-in user %d</description>\n"
+		"    <profile_image_url>http://%s/icons/user%d.png</profile_image_url>\n"
+		"  </user>\n"
+		"</status>\n", user + 1, user, user, user, host, user);
+}
+
+/**
+ * newest first. since_id of 0 gives the whole page.
+ */
+static long make_timeline(BUFFER* buf, const char* host, long since_id) {
+	long last, first, index;
+
+	pthread_mutex_lock(&timeline_lock);
+	make_statuses(new_statuses, time(NULL));
+	last = status_count - 1;
+	first = last - page_statuses + 1;
+	if (first < 0) first = 0;
+	if (since_id >= FIRST_STATUS_ID && since_id - FIRST_STATUS_ID + 1 > first)
+		first = since_id - FIRST_STATUS_ID + 1;
+	buffer_printf(buf, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<statuses type=\"array\">\n");
+	for(index = last; index >= first; index--)
+		append_status(buf, host, index, NULL);
+	buffer_printf(buf, "</statuses>\n");
+	pthread_mutex_unlock(&timeline_lock);
+	return FIRST_STATUS_ID + last;
+}
+
+static void make_posted_status(BUFFER* buf, const char* host, const char* text) {
+	pthread_mutex_lock(&timeline_lock);
+	make_statuses(1, time(NULL));
+	buffer_printf(buf, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	append_status(buf, host, status_count - 1, text);
+	pthread_mutex_unlock(&timeline_lock);
+}
+
+/**
+ * connection
+ */
+static int send_all(int fd, const char* data, size_t size) {
+	size_t chunk = size;
+
+	if (bandwidth > 0) {
+		/* a slice of the bandwidth every 50 msec */
+		chunk = bandwidth / 20;
+		if (chunk < 512) chunk = 512;
+	}
+	while(size > 0) {
+		size_t len = size < chunk ? size : chunk;
+		ssize_t sent = send(fd, data, len, MSG_NOSIGNAL);
+		if (sent <= 0) return -1;
+		data += sent;
+		size -= sent;
+		if (bandwidth > 0 && size > 0) usleep((useconds_t)((double)sent * 1000000 / bandwidth));
+	}
+	return 0;
+}
+
+static int send_response(int fd, int status, const char* reason, const char* headers, const char* body, size_t size) {
+	char head[1024];
+	int len;
+
+	if (latency > 0) usleep(latency * 1000);
+	len = snprintf(head, sizeof(head),
+		"HTTP/1.1 %d %s\r\n"
+		"Content-Length: %lu\r\n"
+		"%s"
+		"\r\n", status, reason, (unsigned long)size, headers ? headers : "");
+	if (send_all(fd, head, len) < 0) return -1;
+	if (size && send_all(fd, body, size) < 0) return -1;
+	return 0;
+}
+
+static const char* find_header(const char* request, const char* name, char* value, size_t size) {
+	const char* ptr = request;
+	size_t len = strlen(name);
+
+	while((ptr = strstr(ptr, "\r\n"))) {
+		ptr += 2;
+		if (!strncasecmp(ptr, name, len) && ptr[len] == ':') {
+			const char* end;
+			ptr += len + 1;
+			while(*ptr == ' ') ptr++;
+			end = strstr(ptr, "\r\n");
+			if (!end) end = ptr + strlen(ptr);
+			if ((size_t)(end - ptr) >= size) end = ptr + size - 1;
+			memcpy(value, ptr, end - ptr);
+			value[end - ptr] = 0;
+			return value;
+		}
+	}
+	return NULL;
+}
+
+static void url_decode(char* str) {
+	char* out = str;
+	for(; *str; str++) {
+		if (*str == '+')
+			*out++ = ' ';
+		else
+		if (*str == '%' && str[1] && str[2]) {
+			char hex[3] = { str[1], str[2], 0 };
+			*out++ = (char)strtol(hex, NULL, 16);
+			str += 2;
+		} else
+			*out++ = *str;
+	}
+	*out = 0;
+}
+
+static int serve_file(int fd, const char* path, const char* mime) {
+	char headers[256];
+	BUFFER buf = { NULL, 0, 0 };
+	char data[8192];
+	size_t len;
+	FILE* fp = fopen(path, "rb");
+	int ret;
+
+	if (!fp) return 1;
+	while((len = fread(data, 1, sizeof(data), fp)) > 0)
+		buffer_append(&buf, data, len);
+	fclose(fp);
+	snprintf(headers, sizeof(headers), "Content-Type: %s\r\n", mime);
+	ret = send_response(fd, 200, "OK", headers, buf.data ? buf.data : "", buf.size);
+	free(buf.data);
+	return ret;
+}
+
+static int handle_request(int fd, char* request) {
+	char method[16], target[2048], host[256], value[256], headers[512];
+	char* query;
+	BUFFER buf = { NULL, 0, 0 };
+	int ret = 0;
+
+	if (sscanf(request, "%15s %2047s", method, target) != 2) return -1;
+	if (!find_header(request, "Host", host, sizeof(host)))
+		snprintf(host, sizeof(host), "127.0.0.1:%d", port);
+	query = strchr(target, '?');
+	if (query) *query++ = 0;
+
+	if (!strncmp(target, "/icons/", 7)) {
+		if (find_header(request, "If-None-Match", value, sizeof(value)) && !strcmp(value, "\"icon\""))
+			return send_response(fd, 304, "Not Modified", "ETag: \"icon\"\r\n", NULL, 0);
+		return send_response(fd, 200, "OK",
+			"Content-Type: image/png\r\nETag: \"icon\"\r\nCache-Control: max-age=86400\r\n",
+			icon_data, icon_size);
+	}
+
+	if (!strcmp(method, "POST") && !strcmp(target, "/statuses/update.xml")) {
+		char* text = query ? strstr(query, "status=") : NULL;
+		char* end;
+		if (text) {
+			text += 7;
+			if ((end = strchr(text, '&'))) *end = 0;
+			url_decode(text);
+		}
+		make_posted_status(&buf, host, text ? text : "");
+		ret = send_response(fd, 200, "OK", "Content-Type: application/xml\r\n", buf.data, buf.size);
+		free(buf.data);
+		return ret;
+	}
+
+	if (!strncmp(target, "/statuses/", 10) && strstr(target, ".xml")) {
+		long since_id = 0;
+		long newest;
+		char etag[64];
+
+		if (replay_dir) {
+			char path[4096];
+			snprintf(path, sizeof(path), "%s%s", replay_dir, target);
+			if (!access(path, R_OK)) return serve_file(fd, path, "application/xml");
+		}
+		if (query && strstr(query, "since_id="))
+			since_id = atol(strstr(query, "since_id=") + 9);
+		newest = make_timeline(&buf, host, since_id);
+		snprintf(etag, sizeof(etag), "\"%ld-%ld\"", newest, since_id);
+		if (find_header(request, "If-None-Match", value, sizeof(value)) && !strcmp(value, etag)) {
+			snprintf(headers, sizeof(headers), "ETag: %s\r\n", etag);
+			ret = send_response(fd, 304, "Not Modified", headers, NULL, 0);
+		} else {
+			snprintf(headers, sizeof(headers), "Content-Type: application/xml\r\nETag: %s\r\n", etag);
+			ret = send_response(fd, 200, "OK", headers, buf.data, buf.size);
+		}
+		free(buf.data);
+		return ret;
+	}
+
+	if (!strcmp(target, "/"))
+		return send_response(fd, 200, "OK", "Content-Type: text/html\r\n", NULL, 0);
+	return send_response(fd, 404, "Not Found", "Content-Type: text/plain\r\n", "not found", 9);
+}
+
+/**
+ * keep-alive connection. bodies of requests are skipped.
+ */
+static void* connection_thread(void* data) {
+	int fd = (int)(long)data;
+	char* request = malloc(REQUEST_MAX + 1);
+	size_t len = 0;
+
+	for(;;) {
+		char* end;
+		char value[64];
+		size_t head, body = 0;
+		ssize_t got;
+		int close_after = 0;
+
+		while(!(end = (len ? strstr(request, "\r\n\r\n") : NULL))) {
+			if (len >= REQUEST_MAX) goto leave;
+			got = recv(fd, request + len, REQUEST_MAX - len, 0);
+			if (got <= 0) goto leave;
+			len += got;
+			request[len] = 0;
+		}
+		head = end - request + 4;
+		if (find_header(request, "Content-Length", value, sizeof(value)))
+			body = (size_t)atol(value);
+		if (find_header(request, "Connection", value, sizeof(value)) && !strcasecmp(value, "close"))
+			close_after = 1;
+		request[head - 2] = 0;
+		if (handle_request(fd, request) < 0) goto leave;
+		if (close_after) goto leave;
+
+		/* drop the request and its body, keep what came after */
+		memmove(request, request + head, len - head);
+		len -= head;
+		while(body > len) {
+			body -= len;
+			got = recv(fd, request, REQUEST_MAX, 0);
+			if (got <= 0) goto leave;
+			len = got;
+		}
+		memmove(request, request + body, len - body);
+		len -= body;
+		request[len] = 0;
+	}
+
+leave:
+	free(request);
+	close(fd);
+	return NULL;
+}
+
+static int load_icon(const char* path) {
+	BUFFER buf = { NULL, 0, 0 };
+	char data[8192];
+	size_t len;
+	FILE* fp = fopen(path, "rb");
+
+	if (!fp) return 0;
+	while((len = fread(data, 1, sizeof(data), fp)) > 0)
+		buffer_append(&buf, data, len);
+	fclose(fp);
+	icon_data = buf.data;
+	icon_size = buf.size;
+	return 1;
+}
+
+int main(int argc, char* argv[]) {
+	struct sockaddr_in addr;
+	int server, on = 1;
+	int n;
+
+	for(n = 1; n < argc - 1; n += 2) {
+		if (!strcmp(argv[n], "--port")) port = atoi(argv[n+1]);
+		else if (!strcmp(argv[n], "--statuses")) page_statuses = atoi(argv[n+1]);
+		else if (!strcmp(argv[n], "--new")) new_statuses = atoi(argv[n+1]);
+		else if (!strcmp(argv[n], "--users")) users = atoi(argv[n+1]);
+		else if (!strcmp(argv[n], "--latency")) latency = atoi(argv[n+1]);
+		else if (!strcmp(argv[n], "--bandwidth")) bandwidth = atol(argv[n+1]);
+		else if (!strcmp(argv[n], "--icon")) icon_path = argv[n+1];
+		else if (!strcmp(argv[n], "--replay")) replay_dir = argv[n+1];
+		else break;
+	}
+	if (n < argc) {
+		fprintf(stderr, "usage: %s [--port n] [--statuses n] [--new n] [--users n] "
+				"[--latency msec] [--bandwidth bytes/sec] [--icon png] [--replay dir]\n", argv[0]);
+		return 1;
+	}
+	if (page_statuses < 1) page_statuses = 1;
+	if (page_statuses > STATUSES_MAX) page_statuses = STATUSES_MAX;
+	if (users < 1) users = 1;
+	if (!load_icon(icon_path)) {
+		perror(icon_path);
+		return 1;
+	}
+	signal(SIGPIPE, SIG_IGN);
+
+	/* a full page is there from the start, a minute apart */
+	make_statuses(page_statuses, 0);
+	for(n = 0; n < page_statuses; n++)
+		created[n] = time(NULL) - (page_statuses - n) * 60;
+
+	server = socket(AF_INET, SOCK_STREAM, 0);
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(port);
+	if (bind(server, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(server, 64) < 0) {
+		perror("bind");
+		return 1;
+	}
+	fprintf(stderr, "bench_server: listening on 127.0.0.1:%d\n", port);
+
+	for(;;) {
+		pthread_t thread;
+		int fd = accept(server, NULL, NULL);
+		if (fd < 0) continue;
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+		if (pthread_create(&thread, NULL, connection_thread, (void*)(long)fd) != 0) {
+			close(fd);
+			continue;
+		}
+		pthread_detach(thread);
+	}
+	return 0;
+}
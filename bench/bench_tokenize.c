@@ -0,0 +1,243 @@
+/**
+ * throughput of splitting status texts into plain text and links.
+ *
+ * "strchr" is the old way: every byte is compared with the markers, and
+ * every letter of a link is looked up in a string of accepted letters.
+ * "table" is statustext.c, one pass with a table of byte classes.
+ *
+ * statuses are read one per line from the file given, or made from the
+ * samples below, which mix ascii, japanese, chinese and korean text.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glib.h>
+#include "statustext.h"
+
+#define CORPUS_STATUSES  200000
+#define ROUNDS           5
+
+#define ACCEPT_LETTER_URL   "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789;/?:@&=+$,-_.!~*'%"
+#define ACCEPT_LETTER_NAME  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+#define ACCEPT_LETTER_REPLY "1234567890"
+
+static const char* samples[] = {
+	"just setting up my twttr",
+	"reading http://example.com/2009/01/some-long-article-name?ref=rss and it's good",
+	"@mattn_jp thanks! I'll try the new build tonight",
+	"\xe4\xbb\x8a\xe6\x97\xa5\xe3\x81\xaf\xe3\x81\x84\xe3\x81\x84\xe5\xa4\xa9\xe6\xb0\x97\xe3\x81\xa0\xe3\x81\xad\xe3\x80\x82\xe6\x95\xa3\xe6\xad\xa9\xe3\x81\xab\xe8\xa1\x8c\xe3\x81\x93\xe3\x81\x86\xe3\x81\x8b\xe3\x81\xaa",
+	"\xef\xbc\xa0yukihiro_matz \xe3\x81\x82\xe3\x82\x8a\xe3\x81\x8c\xe3\x81\xa8\xe3\x81\x86\xe3\x81\x94\xe3\x81\x96\xe3\x81\x84\xe3\x81\xbe\xe3\x81\x99 http://d.hatena.ne.jp/mattn/20090101/1230796800",
+	">>1234567890 \xe3\x81\x9d\xe3\x82\x8c\xe3\x81\xaf\xe3\x81\xa9\xe3\x81\x86\xe3\x81\x8b\xe3\x81\xaa\xe3\x80\x82@someone \xe3\x81\xaf\xe3\x81\xa9\xe3\x81\x86\xe6\x80\x9d\xe3\x81\x86\xef\xbc\x9f",
+	"\xe6\x88\x91\xe4\xbb\x8a\xe5\xa4\xa9\xe5\x9c\xa8\xe5\x8c\x97\xe4\xba\xac\xef\xbc\x8c\xe5\xa4\xa9\xe6\xb0\x94\xe5\xbe\x88\xe5\xa5\xbd\xe3\x80\x82 http://example.cn/photo/12345",
+	"\xec\x98\xa4\xeb\x8a\x98\xec\x9d\x80 \xec\xa0\x95\xeb\xa7\x90 \xeb\xb0\x94\xec\x81\x9c \xed\x95\x98\xeb\xa3\xa8\xec\x98\x80\xeb\x8b\xa4 @friend_kr",
+	"RT @someone: ftp://ftp.example.org/pub/release-1.0.tar.gz is out, mail me at me@example.com",
+	"lunch \xf0\x9f\x8d\x99 with @a @b and @c_d. http://tinyurl.com/abc123 http://tinyurl.com/def456",
+};
+
+/**
+ * old scanners, as they were in gtktwitter.c
+ */
+typedef void (*STATUS_TEXT_FUNC)(const char* text, int len, const char* link, gpointer user_data);
+
+static void scan_status_text(const char* status, STATUS_TEXT_FUNC func, gpointer user_data) {
+	char* ptr = (char*)status;
+	char* last = ptr;
+	if (!status) return;
+	while(*ptr) {
+		if (!strncmp(ptr, "http://", 7) || !strncmp(ptr, "ftp://", 6)) {
+			int len;
+			char* link;
+			char* tmp;
+
+			if (last != ptr)
+				func(last, ptr-last, NULL, user_data);
+
+			tmp = ptr;
+			while(*tmp && strchr(ACCEPT_LETTER_URL, *tmp)) tmp++;
+			len = (int)(tmp-ptr);
+			link = malloc(len+1);
+			memset(link, 0, len+1);
+			strncpy(link, ptr, len);
+			func(link, len, link, user_data);
+			free(link);
+			ptr = last = tmp;
+		} else
+		if (*ptr == '@' || !strncmp(ptr, "\xef\xbc\xa0", 3)) {
+			int len;
+			char* link;
+			char* tmp;
+			gchar* url;
+			gchar* user_name;
+
+			if (last != ptr)
+				func(last, ptr-last, NULL, user_data);
+
+			user_name = tmp = ptr + (*ptr == '@' ? 1 : 3);
+			while(*tmp && strchr(ACCEPT_LETTER_NAME, *tmp)) tmp++;
+			len = (int)(tmp-user_name);
+			if (len) {
+				link = malloc(len+1);
+				memset(link, 0, len+1);
+				strncpy(link, user_name, len);
+				url = g_strdup_printf("@%s", link);
+				free(link);
+				func(url, -1, url, user_data);
+				g_free(url);
+				ptr = last = tmp;
+			} else
+				ptr = tmp;
+		} else
+		if (!strncmp(ptr, ">>", 2)) {
+			int len;
+			char* link;
+			char* tmp;
+			gchar* url;
+
+			if (last != ptr)
+				func(last, ptr-last, NULL, user_data);
+
+			url = tmp = ptr + 2;
+			while(*tmp && strchr(ACCEPT_LETTER_REPLY, *tmp)) tmp++;
+			len = (int)(tmp-url);
+			if (len) {
+				link = malloc(len+1);
+				memset(link, 0, len+1);
+				strncpy(link, url, len);
+				url = g_strdup_printf(">>%s", link);
+				free(link);
+				func(url, -1, url, user_data);
+				g_free(url);
+				ptr = last = tmp;
+			} else
+				ptr = tmp;
+		} else
+			ptr++;
+	}
+	if (last != ptr)
+		func(last, ptr-last, NULL, user_data);
+}
+
+static void count_span(const char* text, int len, const char* link, gpointer user_data) {
+	if (link) (*(int*)user_data)++;
+}
+
+/* the url scan of the post path, without asking tinyurl */
+static int scan_message_urls(const char* message) {
+	const char* ptr = message;
+	int links = 0;
+	while(*ptr) {
+		if (!strncmp(ptr, "http://", 7) || !strncmp(ptr, "ftp://", 6)) {
+			const char* tmp = ptr;
+			char* link;
+			while(*tmp && strchr(ACCEPT_LETTER_URL, *tmp)) tmp++;
+			link = malloc(tmp-ptr+1);
+			memset(link, 0, tmp-ptr+1);
+			memcpy(link, ptr, tmp-ptr);
+			free(link);
+			links++;
+			ptr = tmp;
+		} else
+			ptr++;
+	}
+	return links;
+}
+
+/**
+ * corpus
+ */
+static GPtrArray* load_corpus(const char* path, size_t* bytes) {
+	GPtrArray* corpus = g_ptr_array_new();
+	char line[8192];
+	int n;
+
+	*bytes = 0;
+	if (path) {
+		FILE* fp = fopen(path, "r");
+		if (!fp) {
+			perror(path);
+			exit(1);
+		}
+		while(fgets(line, sizeof(line), fp)) {
+			g_strchomp(line);
+			if (!*line) continue;
+			g_ptr_array_add(corpus, g_strdup(line));
+			*bytes += strlen(line);
+		}
+		fclose(fp);
+		return corpus;
+	}
+	for(n = 0; n < CORPUS_STATUSES; n++) {
+		const char* sample = samples[n % (sizeof(samples)/sizeof(samples[0]))];
+		g_ptr_array_add(corpus, g_strdup(sample));
+		*bytes += strlen(sample);
+	}
+	return corpus;
+}
+
+static double bench_strchr(GPtrArray* corpus, gboolean post, int* links) {
+	GTimer* timer = g_timer_new();
+	double elapsed;
+	guint n;
+
+	*links = 0;
+	for(n = 0; n < corpus->len; n++) {
+		const char* text = (const char*)g_ptr_array_index(corpus, n);
+		if (post)
+			*links += scan_message_urls(text);
+		else
+			scan_status_text(text, count_span, links);
+	}
+	elapsed = g_timer_elapsed(timer, NULL);
+	g_timer_destroy(timer);
+	return elapsed;
+}
+
+static double bench_table(GPtrArray* corpus, gboolean post, int* links) {
+	GArray* tokens = g_array_new(FALSE, FALSE, sizeof(STATUS_TOKEN));
+	GTimer* timer = g_timer_new();
+	double elapsed;
+	guint n, t;
+
+	*links = 0;
+	for(n = 0; n < corpus->len; n++) {
+		g_array_set_size(tokens, 0);
+		status_text_tokenize((const char*)g_ptr_array_index(corpus, n),
+				post ? STATUS_TEXT_URLS : STATUS_TEXT_ALL, tokens);
+		for(t = 0; t < tokens->len; t++)
+			if (g_array_index(tokens, STATUS_TOKEN, t).kind != STATUS_TOKEN_TEXT) (*links)++;
+	}
+	elapsed = g_timer_elapsed(timer, NULL);
+	g_timer_destroy(timer);
+	g_array_free(tokens, TRUE);
+	return elapsed;
+}
+
+int main(int argc, char* argv[]) {
+	GPtrArray* corpus;
+	size_t bytes;
+	int pass;
+
+	corpus = load_corpus(argc > 1 ? argv[1] : NULL, &bytes);
+	printf("%u statuses, %.1f MB\n", corpus->len, bytes / (1024.0*1024.0));
+	printf("%-6s %-8s %8s %10s %10s\n", "path", "scanner", "links", "msec", "MB/s");
+	for(pass = 0; pass < 2; pass++) {
+		const char* path = pass ? "post" : "render";
+		double old_best = 0, new_best = 0;
+		int old_links = 0, new_links = 0;
+		int round;
+		for(round = 0; round < ROUNDS; round++) {
+			double old_time = bench_strchr(corpus, pass, &old_links);
+			double new_time = bench_table(corpus, pass, &new_links);
+			if (!round || old_time < old_best) old_best = old_time;
+			if (!round || new_time < new_best) new_best = new_time;
+		}
+		printf("%-6s %-8s %8d %10.2f %10.1f\n", path, "strchr", old_links, old_best*1000, bytes / old_best / (1024*1024));
+		printf("%-6s %-8s %8d %10.2f %10.1f\n", path, "table", new_links, new_best*1000, bytes / new_best / (1024*1024));
+		printf("%-6s %-8s %8s %9.1fx\n", path, "speedup", "", old_best / new_best);
+		if (old_links != new_links) {
+			fprintf(stderr, "%s: scanners found different links\n", path);
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,312 @@
+#include <stdlib.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "cache.h"
+
+#define CACHE_INDEX_NAME "index"
+
+struct _CACHE {
+	char* dir;
+	size_t max_size;
+	size_t total_size;
+	GHashTable* entries;	/* key -> CACHE_ENTRY */
+	gboolean dirty;
+	GMutex* lock;
+};
+
+/**
+ * file name of the body, derived from the key.
+ */
+static char* cache_path_alloc(CACHE* cache, const char* key) {
+	gchar* hash = g_compute_checksum_for_string(G_CHECKSUM_MD5, key, -1);
+	gchar* path = g_build_filename(cache->dir, hash, NULL);
+	g_free(hash);
+	return path;
+}
+
+static char* strdup_or_null(const char* str) {
+	return (str && *str) ? g_strdup(str) : NULL;
+}
+
+void cache_entry_free(CACHE_ENTRY* entry) {
+	if (!entry) return;
+	g_free(entry->key);
+	g_free(entry->etag);
+	g_free(entry->last_modified);
+	g_free(entry->mime);
+	g_free(entry);
+}
+
+static CACHE_ENTRY* cache_entry_copy(const CACHE_ENTRY* entry) {
+	CACHE_ENTRY* copy = g_new0(CACHE_ENTRY, 1);
+	*copy = *entry;
+	copy->key = g_strdup(entry->key);
+	copy->etag = g_strdup(entry->etag);
+	copy->last_modified = g_strdup(entry->last_modified);
+	copy->mime = g_strdup(entry->mime);
+	return copy;
+}
+
+/**
+ * index file has one entry per line:
+ *   status \t expires \t accessed \t size \t etag \t last-modified \t mime \t key
+ */
+static void cache_load_index(CACHE* cache) {
+	gchar* path = g_build_filename(cache->dir, CACHE_INDEX_NAME, NULL);
+	gchar* data = NULL;
+	gchar** lines;
+	int n;
+
+	if (!g_file_get_contents(path, &data, NULL, NULL)) goto leave;
+	lines = g_strsplit(data, "\n", 0);
+	for(n = 0; lines[n]; n++) {
+		gchar** fields = g_strsplit(lines[n], "\t", 8);
+		CACHE_ENTRY* entry;
+		CACHE_ENTRY* old;
+		if (g_strv_length(fields) != 8 || !*fields[7]) {
+			g_strfreev(fields);
+			continue;
+		}
+		entry = g_new0(CACHE_ENTRY, 1);
+		entry->status = atol(fields[0]);
+		entry->expires = (time_t)g_ascii_strtoll(fields[1], NULL, 10);
+		entry->accessed = (time_t)g_ascii_strtoll(fields[2], NULL, 10);
+		entry->size = (size_t)g_ascii_strtoull(fields[3], NULL, 10);
+		entry->etag = strdup_or_null(fields[4]);
+		entry->last_modified = strdup_or_null(fields[5]);
+		entry->mime = strdup_or_null(fields[6]);
+		entry->key = g_strdup(fields[7]);
+		/* a key found again replaces the one before */
+		old = (CACHE_ENTRY*)g_hash_table_lookup(cache->entries, entry->key);
+		if (old) cache->total_size -= old->size;
+		cache->total_size += entry->size;
+		g_hash_table_replace(cache->entries, entry->key, entry);
+		g_strfreev(fields);
+	}
+	g_strfreev(lines);
+
+leave:
+	g_free(data);
+	g_free(path);
+}
+
+static void cache_format_entry(gpointer key, gpointer value, gpointer user_data) {
+	CACHE_ENTRY* entry = (CACHE_ENTRY*)value;
+	g_string_append_printf((GString*)user_data, "%ld\t%ld\t%ld\t%lu\t%s\t%s\t%s\t%s\n",
+		entry->status,
+		(long)entry->expires,
+		(long)entry->accessed,
+		(unsigned long)entry->size,
+		entry->etag ? entry->etag : "",
+		entry->last_modified ? entry->last_modified : "",
+		entry->mime ? entry->mime : "",
+		entry->key);
+}
+
+/**
+ * drop an entry and its body. lock must be held.
+ */
+static void cache_drop(CACHE* cache, CACHE_ENTRY* entry) {
+	gchar* path = cache_path_alloc(cache, entry->key);
+	g_unlink(path);
+	g_free(path);
+	cache->total_size -= entry->size;
+	cache->dirty = TRUE;
+	g_hash_table_remove(cache->entries, entry->key);
+}
+
+static void cache_collect_entry(gpointer key, gpointer value, gpointer user_data) {
+	g_ptr_array_add((GPtrArray*)user_data, value);
+}
+
+static int cache_compare_accessed(gconstpointer a, gconstpointer b) {
+	const CACHE_ENTRY* ea = *(const CACHE_ENTRY**)a;
+	const CACHE_ENTRY* eb = *(const CACHE_ENTRY**)b;
+	if (ea->accessed < eb->accessed) return -1;
+	if (ea->accessed > eb->accessed) return 1;
+	return 0;
+}
+
+/**
+ * least recently used entries go first until the cache fits in max_size.
+ * lock must be held.
+ */
+static void cache_evict(CACHE* cache) {
+	GPtrArray* entries;
+	guint n;
+
+	if (cache->total_size <= cache->max_size) return;
+	entries = g_ptr_array_new();
+	g_hash_table_foreach(cache->entries, cache_collect_entry, entries);
+	g_ptr_array_sort(entries, cache_compare_accessed);
+	for(n = 0; n < entries->len && cache->total_size > cache->max_size; n++)
+		cache_drop(cache, (CACHE_ENTRY*)g_ptr_array_index(entries, n));
+	g_ptr_array_free(entries, TRUE);
+}
+
+CACHE* cache_open(const char* dir, size_t max_size) {
+	CACHE* cache;
+
+	if (g_mkdir_with_parents(dir, 0700) != 0) return NULL;
+	cache = g_new0(CACHE, 1);
+	cache->dir = g_strdup(dir);
+	cache->max_size = max_size;
+	cache->entries = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, (GDestroyNotify)cache_entry_free);
+	cache->lock = g_mutex_new();
+	cache_load_index(cache);
+	cache_evict(cache);
+	return cache;
+}
+
+void cache_close(CACHE* cache) {
+	if (!cache) return;
+	cache_save(cache);
+	g_hash_table_destroy(cache->entries);
+	g_mutex_free(cache->lock);
+	g_free(cache->dir);
+	g_free(cache);
+}
+
+/**
+ * write the index back if something was changed since the last save.
+ */
+gboolean cache_save(CACHE* cache) {
+	GString* buf;
+	gchar* path;
+	gboolean ret = TRUE;
+
+	g_mutex_lock(cache->lock);
+	if (cache->dirty) {
+		buf = g_string_sized_new(4096);
+		g_hash_table_foreach(cache->entries, cache_format_entry, buf);
+		path = g_build_filename(cache->dir, CACHE_INDEX_NAME, NULL);
+		ret = g_file_set_contents(path, buf->str, buf->len, NULL);
+		if (ret) cache->dirty = FALSE;
+		g_free(path);
+		g_string_free(buf, TRUE);
+	}
+	g_mutex_unlock(cache->lock);
+	return ret;
+}
+
+/**
+ * returns a copy of the entry, or NULL. the caller decides from expires
+ * whether it can be used as is or must be revalidated with etag and
+ * last_modified.
+ */
+CACHE_ENTRY* cache_lookup(CACHE* cache, const char* key) {
+	CACHE_ENTRY* entry;
+	CACHE_ENTRY* copy = NULL;
+
+	g_mutex_lock(cache->lock);
+	entry = (CACHE_ENTRY*)g_hash_table_lookup(cache->entries, key);
+	if (entry) {
+		entry->accessed = time(NULL);
+		cache->dirty = TRUE;
+		copy = cache_entry_copy(entry);
+	}
+	g_mutex_unlock(cache->lock);
+	return copy;
+}
+
+/**
+ * returns the body of the entry. the caller frees it with g_free.
+ */
+char* cache_read(CACHE* cache, const char* key, size_t* size) {
+	gchar* path = cache_path_alloc(cache, key);
+	gchar* data = NULL;
+	gsize len = 0;
+
+	if (!g_file_get_contents(path, &data, &len, NULL)) {
+		/* body was lost. forget the entry so that it is fetched again. */
+		cache_remove(cache, key);
+		data = NULL;
+		len = 0;
+	}
+	g_free(path);
+	if (size) *size = len;
+	return data;
+}
+
+/**
+ * the body is written to a file of its own first, then it replaces the one
+ * of the entry and the entry is changed in one step under the lock, so the
+ * body and the entry of the index always go together.
+ */
+void cache_store(CACHE* cache, const char* key, long status, const char* etag, const char* last_modified, const char* mime, time_t expires, const char* data, size_t size) {
+	CACHE_ENTRY* entry;
+	CACHE_ENTRY* old;
+	gchar* path = cache_path_alloc(cache, key);
+	gchar* temp_path = NULL;
+
+	if (status != 200) size = 0;
+	if (size) {
+		temp_path = g_strdup_printf("%s.%p", path, (void*)g_thread_self());
+		if (!g_file_set_contents(temp_path, data, size, NULL)) {
+			g_unlink(temp_path);
+			g_free(temp_path);
+			g_free(path);
+			return;
+		}
+	}
+
+	entry = g_new0(CACHE_ENTRY, 1);
+	entry->key = g_strdup(key);
+	entry->status = status;
+	entry->etag = strdup_or_null(etag);
+	entry->last_modified = strdup_or_null(last_modified);
+	entry->mime = strdup_or_null(mime);
+	entry->expires = expires;
+	entry->accessed = time(NULL);
+	entry->size = size;
+
+	g_mutex_lock(cache->lock);
+	if (temp_path) {
+#ifdef _WIN32
+		g_unlink(path);
+#endif
+		if (g_rename(temp_path, path) != 0) {
+			g_mutex_unlock(cache->lock);
+			g_unlink(temp_path);
+			g_free(temp_path);
+			g_free(path);
+			cache_entry_free(entry);
+			return;
+		}
+	} else
+		g_unlink(path);
+	old = (CACHE_ENTRY*)g_hash_table_lookup(cache->entries, key);
+	if (old) cache->total_size -= old->size;
+	g_hash_table_replace(cache->entries, entry->key, entry);
+	cache->total_size += size;
+	cache->dirty = TRUE;
+	cache_evict(cache);
+	g_mutex_unlock(cache->lock);
+	g_free(temp_path);
+	g_free(path);
+}
+
+/**
+ * entry was revalidated by the server. keep the body, extend freshness.
+ */
+void cache_touch(CACHE* cache, const char* key, time_t expires) {
+	CACHE_ENTRY* entry;
+
+	g_mutex_lock(cache->lock);
+	entry = (CACHE_ENTRY*)g_hash_table_lookup(cache->entries, key);
+	if (entry) {
+		entry->expires = expires;
+		entry->accessed = time(NULL);
+		cache->dirty = TRUE;
+	}
+	g_mutex_unlock(cache->lock);
+}
+
+void cache_remove(CACHE* cache, const char* key) {
+	CACHE_ENTRY* entry;
+
+	g_mutex_lock(cache->lock);
+	entry = (CACHE_ENTRY*)g_hash_table_lookup(cache->entries, key);
+	if (entry) cache_drop(cache, entry);
+	g_mutex_unlock(cache->lock);
+}
@@ -0,0 +1,38 @@
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include <time.h>
+#include <glib.h>
+
+/**
+ * on-disk content cache
+ *
+ * bodies are kept in one file per key, validators and bookkeeping in an
+ * index file of the cache directory. when the total size goes over
+ * max_size, least recently used entries are dropped. entries with a status
+ * other than 200 have no body and work as negative cache.
+ */
+typedef struct _CACHE CACHE;
+
+typedef struct _CACHE_ENTRY {
+	char* key;		/* ex: url */
+	long status;		/* http status code */
+	char* etag;		/* ETag */
+	char* last_modified;	/* Last-Modified */
+	char* mime;		/* content-type */
+	time_t expires;		/* fresh until */
+	time_t accessed;	/* last lookup */
+	size_t size;		/* size of body */
+} CACHE_ENTRY;
+
+CACHE* cache_open(const char* dir, size_t max_size);
+void cache_close(CACHE* cache);
+gboolean cache_save(CACHE* cache);
+CACHE_ENTRY* cache_lookup(CACHE* cache, const char* key);
+char* cache_read(CACHE* cache, const char* key, size_t* size);
+void cache_store(CACHE* cache, const char* key, long status, const char* etag, const char* last_modified, const char* mime, time_t expires, const char* data, size_t size);
+void cache_touch(CACHE* cache, const char* key, time_t expires);
+void cache_remove(CACHE* cache, const char* key);
+void cache_entry_free(CACHE_ENTRY* entry);
+
+#endif /* _CACHE_H_ */
@@ -0,0 +1,248 @@
+#include <stdlib.h>
+#include <string.h>
+#include "entity.h"
+
+#define ENTITY_NAME_MAX  8
+#define REPLACEMENT_CHAR 0xfffd
+
+/**
+ * named entities of html 4 and "&apos;", sorted by name.
+ */
+typedef struct _ENTITY {
+	const char* name;
+	unsigned int code;
+} ENTITY;
+
+static const ENTITY entities[] = {
+	{ "AElig", 198 }, { "Aacute", 193 }, { "Acirc", 194 },
+	{ "Agrave", 192 }, { "Alpha", 913 }, { "Aring", 197 },
+	{ "Atilde", 195 }, { "Auml", 196 }, { "Beta", 914 },
+	{ "Ccedil", 199 }, { "Chi", 935 }, { "Dagger", 8225 },
+	{ "Delta", 916 }, { "ETH", 208 }, { "Eacute", 201 },
+	{ "Ecirc", 202 }, { "Egrave", 200 }, { "Epsilon", 917 },
+	{ "Eta", 919 }, { "Euml", 203 }, { "Gamma", 915 }, { "Iacute", 205 },
+	{ "Icirc", 206 }, { "Igrave", 204 }, { "Iota", 921 },
+	{ "Iuml", 207 }, { "Kappa", 922 }, { "Lambda", 923 }, { "Mu", 924 },
+	{ "Ntilde", 209 }, { "Nu", 925 }, { "OElig", 338 },
+	{ "Oacute", 211 }, { "Ocirc", 212 }, { "Ograve", 210 },
+	{ "Omega", 937 }, { "Omicron", 927 }, { "Oslash", 216 },
+	{ "Otilde", 213 }, { "Ouml", 214 }, { "Phi", 934 }, { "Pi", 928 },
+	{ "Prime", 8243 }, { "Psi", 936 }, { "Rho", 929 }, { "Scaron", 352 },
+	{ "Sigma", 931 }, { "THORN", 222 }, { "Tau", 932 }, { "Theta", 920 },
+	{ "Uacute", 218 }, { "Ucirc", 219 }, { "Ugrave", 217 },
+	{ "Upsilon", 933 }, { "Uuml", 220 }, { "Xi", 926 },
+	{ "Yacute", 221 }, { "Yuml", 376 }, { "Zeta", 918 },
+	{ "aacute", 225 }, { "acirc", 226 }, { "acute", 180 },
+	{ "aelig", 230 }, { "agrave", 224 }, { "alefsym", 8501 },
+	{ "alpha", 945 }, { "amp", 38 }, { "and", 8743 }, { "ang", 8736 },
+	{ "apos", 39 }, { "aring", 229 }, { "asymp", 8776 },
+	{ "atilde", 227 }, { "auml", 228 }, { "bdquo", 8222 },
+	{ "beta", 946 }, { "brvbar", 166 }, { "bull", 8226 },
+	{ "cap", 8745 }, { "ccedil", 231 }, { "cedil", 184 },
+	{ "cent", 162 }, { "chi", 967 }, { "circ", 710 }, { "clubs", 9827 },
+	{ "cong", 8773 }, { "copy", 169 }, { "crarr", 8629 },
+	{ "cup", 8746 }, { "curren", 164 }, { "dArr", 8659 },
+	{ "dagger", 8224 }, { "darr", 8595 }, { "deg", 176 },
+	{ "delta", 948 }, { "diams", 9830 }, { "divide", 247 },
+	{ "eacute", 233 }, { "ecirc", 234 }, { "egrave", 232 },
+	{ "empty", 8709 }, { "emsp", 8195 }, { "ensp", 8194 },
+	{ "epsilon", 949 }, { "equiv", 8801 }, { "eta", 951 },
+	{ "eth", 240 }, { "euml", 235 }, { "euro", 8364 }, { "exist", 8707 },
+	{ "fnof", 402 }, { "forall", 8704 }, { "frac12", 189 },
+	{ "frac14", 188 }, { "frac34", 190 }, { "frasl", 8260 },
+	{ "gamma", 947 }, { "ge", 8805 }, { "gt", 62 }, { "hArr", 8660 },
+	{ "harr", 8596 }, { "hearts", 9829 }, { "hellip", 8230 },
+	{ "iacute", 237 }, { "icirc", 238 }, { "iexcl", 161 },
+	{ "igrave", 236 }, { "image", 8465 }, { "infin", 8734 },
+	{ "int", 8747 }, { "iota", 953 }, { "iquest", 191 },
+	{ "isin", 8712 }, { "iuml", 239 }, { "kappa", 954 },
+	{ "lArr", 8656 }, { "lambda", 955 }, { "lang", 9001 },
+	{ "laquo", 171 }, { "larr", 8592 }, { "lceil", 8968 },
+	{ "ldquo", 8220 }, { "le", 8804 }, { "lfloor", 8970 },
+	{ "lowast", 8727 }, { "loz", 9674 }, { "lrm", 8206 },
+	{ "lsaquo", 8249 }, { "lsquo", 8216 }, { "lt", 60 }, { "macr", 175 },
+	{ "mdash", 8212 }, { "micro", 181 }, { "middot", 183 },
+	{ "minus", 8722 }, { "mu", 956 }, { "nabla", 8711 }, { "nbsp", 160 },
+	{ "ndash", 8211 }, { "ne", 8800 }, { "ni", 8715 }, { "not", 172 },
+	{ "notin", 8713 }, { "nsub", 8836 }, { "ntilde", 241 },
+	{ "nu", 957 }, { "oacute", 243 }, { "ocirc", 244 }, { "oelig", 339 },
+	{ "ograve", 242 }, { "oline", 8254 }, { "omega", 969 },
+	{ "omicron", 959 }, { "oplus", 8853 }, { "or", 8744 },
+	{ "ordf", 170 }, { "ordm", 186 }, { "oslash", 248 },
+	{ "otilde", 245 }, { "otimes", 8855 }, { "ouml", 246 },
+	{ "para", 182 }, { "part", 8706 }, { "permil", 8240 },
+	{ "perp", 8869 }, { "phi", 966 }, { "pi", 960 }, { "piv", 982 },
+	{ "plusmn", 177 }, { "pound", 163 }, { "prime", 8242 },
+	{ "prod", 8719 }, { "prop", 8733 }, { "psi", 968 }, { "quot", 34 },
+	{ "rArr", 8658 }, { "radic", 8730 }, { "rang", 9002 },
+	{ "raquo", 187 }, { "rarr", 8594 }, { "rceil", 8969 },
+	{ "rdquo", 8221 }, { "real", 8476 }, { "reg", 174 },
+	{ "rfloor", 8971 }, { "rho", 961 }, { "rlm", 8207 },
+	{ "rsaquo", 8250 }, { "rsquo", 8217 }, { "sbquo", 8218 },
+	{ "scaron", 353 }, { "sdot", 8901 }, { "sect", 167 }, { "shy", 173 },
+	{ "sigma", 963 }, { "sigmaf", 962 }, { "sim", 8764 },
+	{ "spades", 9824 }, { "sub", 8834 }, { "sube", 8838 },
+	{ "sum", 8721 }, { "sup", 8835 }, { "sup1", 185 }, { "sup2", 178 },
+	{ "sup3", 179 }, { "supe", 8839 }, { "szlig", 223 }, { "tau", 964 },
+	{ "there4", 8756 }, { "theta", 952 }, { "thetasym", 977 },
+	{ "thinsp", 8201 }, { "thorn", 254 }, { "tilde", 732 },
+	{ "times", 215 }, { "trade", 8482 }, { "uArr", 8657 },
+	{ "uacute", 250 }, { "uarr", 8593 }, { "ucirc", 251 },
+	{ "ugrave", 249 }, { "uml", 168 }, { "upsih", 978 },
+	{ "upsilon", 965 }, { "uuml", 252 }, { "weierp", 8472 },
+	{ "xi", 958 }, { "yacute", 253 }, { "yen", 165 }, { "yuml", 255 },
+	{ "zeta", 950 }, { "zwj", 8205 }, { "zwnj", 8204 },
+};
+
+static int compare_entity(const void* a, const void* b) {
+	return strcmp(((const ENTITY*)a)->name, ((const ENTITY*)b)->name);
+}
+
+/**
+ * write the code point as utf-8. invalid ones become U+FFFD.
+ */
+static char* put_utf8(char* out, unsigned long code) {
+	if (code == 0 || code > 0x10ffff || (code >= 0xd800 && code <= 0xdfff))
+		code = REPLACEMENT_CHAR;
+	if (code < 0x80) {
+		*out++ = (char)code;
+	} else
+	if (code < 0x800) {
+		*out++ = (char)(0xc0 | (code >> 6));
+		*out++ = (char)(0x80 | (code & 0x3f));
+	} else
+	if (code < 0x10000) {
+		*out++ = (char)(0xe0 | (code >> 12));
+		*out++ = (char)(0x80 | ((code >> 6) & 0x3f));
+		*out++ = (char)(0x80 | (code & 0x3f));
+	} else {
+		*out++ = (char)(0xf0 | (code >> 18));
+		*out++ = (char)(0x80 | ((code >> 12) & 0x3f));
+		*out++ = (char)(0x80 | ((code >> 6) & 0x3f));
+		*out++ = (char)(0x80 | (code & 0x3f));
+	}
+	return out;
+}
+
+/**
+ * entity at ptr, just after the "&". returns the end of it, or NULL when
+ * it is not one, then the "&" is taken as it is.
+ */
+static const char* parse_entity(const char* ptr, unsigned long* code) {
+	const char* end;
+
+	/* the ones markup is escaped with come first */
+	switch (*ptr) {
+	case 'a':
+		if (ptr[1] == 'm' && ptr[2] == 'p' && ptr[3] == ';') { *code = '&'; return ptr + 4; }
+		break;
+	case 'l':
+		if (ptr[1] == 't' && ptr[2] == ';') { *code = '<'; return ptr + 3; }
+		break;
+	case 'g':
+		if (ptr[1] == 't' && ptr[2] == ';') { *code = '>'; return ptr + 3; }
+		break;
+	case 'q':
+		if (!strncmp(ptr, "quot;", 5)) { *code = '"'; return ptr + 5; }
+		break;
+	}
+
+	if (*ptr == '#') {
+		unsigned long value = 0;
+		int digits = 0;
+		ptr++;
+		if (*ptr == 'x' || *ptr == 'X') {
+			for(ptr++; ; ptr++, digits++) {
+				int c = *ptr;
+				if (c >= '0' && c <= '9') c -= '0';
+				else if (c >= 'a' && c <= 'f') c -= 'a' - 10;
+				else if (c >= 'A' && c <= 'F') c -= 'A' - 10;
+				else break;
+				if (value <= 0x10ffff) value = value * 16 + c;
+			}
+		} else {
+			for(; *ptr >= '0' && *ptr <= '9'; ptr++, digits++)
+				if (value <= 0x10ffff) value = value * 10 + (*ptr - '0');
+		}
+		if (!digits || *ptr != ';') return NULL;
+		*code = value;
+		return ptr + 1;
+	} else {
+		char name[ENTITY_NAME_MAX+1];
+		ENTITY key;
+		const ENTITY* entity;
+		int len = 0;
+
+		for(end = ptr; (*end >= 'a' && *end <= 'z') || (*end >= 'A' && *end <= 'Z') || (*end >= '0' && *end <= '9'); end++)
+			if (++len > ENTITY_NAME_MAX) return NULL;
+		if (!len || *end != ';') return NULL;
+		memcpy(name, ptr, len);
+		name[len] = 0;
+		key.name = name;
+		entity = (const ENTITY*)bsearch(&key, entities, sizeof(entities)/sizeof(entities[0]), sizeof(ENTITY), compare_entity);
+		if (!entity) return NULL;
+		*code = entity->code;
+		return end + 1;
+	}
+}
+
+/**
+ * one pass from in to out. the text never grows, an entity is longer than
+ * the utf-8 it stands for, so out may be in.
+ */
+static size_t decode_into(char* out, const char* in, int flags) {
+	char* start = out;
+	char markup = (flags & ENTITY_STRIP_MARKUP) ? '<' : '&';
+	const char* close = NULL;	/* next '>', or the end when there is none */
+	char c;
+
+	while ((c = *in)) {
+		if (c != '&' && c != markup) {
+			*out++ = c;
+			in++;
+			continue;
+		}
+		if (c == '<') {
+			/* looked for again only once it was passed, not for every '<' */
+			if (!close || close < in) {
+				close = strchr(in, '>');
+				if (!close) close = in + strlen(in);
+			}
+			if (*close) {
+				in = close + 1;
+				continue;
+			}
+			/* not markup */
+			*out++ = *in++;
+		} else {
+			unsigned long code;
+			const char* end = parse_entity(in + 1, &code);
+			if (!end) {
+				*out++ = *in++;
+			} else
+			if (code < 0x80 && code) {
+				*out++ = (char)code;
+				in = end;
+			} else {
+				out = put_utf8(out, code);
+				in = end;
+			}
+		}
+	}
+	*out = 0;
+	return (size_t)(out - start);
+}
+
+size_t entity_decode(char* str, int flags) {
+	if (!str) return 0;
+	return decode_into(str, str, flags);
+}
+
+char* entity_decode_alloc(const char* str, int flags) {
+	char* buf;
+
+	if (!str) return NULL;
+	buf = malloc(strlen(str)+1);
+	decode_into(buf, str, flags);
+	return buf;
+}
@@ -0,0 +1,21 @@
+#ifndef _ENTITY_H_
+#define _ENTITY_H_
+
+#include <stddef.h>
+
+/**
+ * entity decoder
+ *
+ * named entities of html 4 and numeric ones ("&#12354;", "&#x1F600;") are
+ * decoded to utf-8 in one pass. entities which are not known are left as
+ * they are, numbers out of unicode become U+FFFD. with ENTITY_STRIP_MARKUP,
+ * "<...>" is removed as well.
+ *
+ * the text never grows, so entity_decode works in place.
+ */
+#define ENTITY_STRIP_MARKUP  (1 << 0)
+
+size_t entity_decode(char* str, int flags);
+char* entity_decode_alloc(const char* str, int flags);
+
+#endif /* _ENTITY_H_ */
@@ -2,13 +2,21 @@
 #include <gdk-pixbuf/gdk-pixbuf.h>
 #include <gdk/gdkkeysyms.h>
 #include <glib/gconvert.h>
-#include <libxml/parser.h>
-#include <libxml/xpath.h>
-#include <libxml/xpathInternals.h>
 #include <curl/curl.h>
 #include <memory.h>
 #include <string.h>
 #include <libintl.h>
+#include "http.h"
+#include "status.h"
+#include "cache.h"
+#include "statusview.h"
+#include "linkstore.h"
+#include "statusstore.h"
+#include "statustime.h"
+#include "statustext.h"
+#include "entity.h"
+#include "outbox.h"
+#include "images.h"
 
 #ifdef _LIBINTL_H
 #include <locale.h>
@@ -18,11 +26,14 @@
 #endif
 
 #ifdef _WIN32
+# include <windows.h>
 # define DATA_DIR "data"
 # define LOCALE_DIR "share/locale"
 # ifndef snprintf
 #  define snprintf _snprintf
 # endif
+#else
+# include <unistd.h>
 #endif
 
 #define APP_TITLE                  "GtkTwitter"
@@ -30,25 +41,54 @@
 #define APP_VERSION                "0.1.0"
 #define APP_URL                    "http://mattn.kaoriya.net/gtktwitter.xml"
 #define SERVICE_NAME               "twitter"
-#define SERVICE_UPDATE_URL         "http://twitter.com/statuses/update.xml"
-#define SERVICE_SELF_STATUS_URL    "http://twitter.com/statuses/friends_timeline.xml"
-#define SERVICE_USER_STATUS_URL    "http://twitter.com/statuses/user_timeline/%s.xml"
-#define SERVICE_THREAD_STATUS_URL  "http://twitter.com/statuses/thread_timeline/%s.xml"
+/* -DSERVICE_ROOT_URL=\"http://127.0.0.1:8931/\" points every api at another server */
+#ifndef SERVICE_ROOT_URL
+#define SERVICE_ROOT_URL           "http://twitter.com/"
+#endif
+#define SERVICE_UPDATE_URL         SERVICE_ROOT_URL "statuses/update.xml"
+#define SERVICE_SELF_STATUS_URL    SERVICE_ROOT_URL "statuses/friends_timeline.xml"
+#define SERVICE_USER_STATUS_URL    SERVICE_ROOT_URL "statuses/user_timeline/%s.xml"
+#define SERVICE_THREAD_STATUS_URL  SERVICE_ROOT_URL "statuses/thread_timeline/%s.xml"
+#define SERVICE_MY_STATUS_URL      SERVICE_ROOT_URL "statuses/user_timeline.xml"
 #define USE_REPLAY_ACCESS          0
+#ifdef USE_REPLAY_ACCESS
+#define STATUS_TEXT_LINKS          STATUS_TEXT_ALL
+#else
+#define STATUS_TEXT_LINKS          (STATUS_TEXT_URLS | STATUS_TEXT_MENTIONS)
+#endif
 #define TINYURL_API_URL            "http://tinyurl.com/api-create.php"
-#define ACCEPT_LETTER_URL          "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789;/?:@&=+$,-_.!~*'%"
-#define ACCEPT_LETTER_NAME         "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
-#define ACCEPT_LETTER_REPLY        "1234567890"
 #define RELOAD_TIMER_SPAN          (60*1000)
-
-#define XML_CONTENT(x) (x->children ? (char*)x->children->content : NULL)
+#define RELOAD_TIMER_MIN_SPAN      (20*1000)
+#define RELOAD_TIMER_MAX_SPAN      (30*60*1000)
+#define RELOAD_TIMER_LIMIT_SPAN    (24*60*60*1000)
+#define RELOAD_TIMER_JITTER        10
+#define ICON_CACHE_MAX_SIZE        (8*1024*1024)
+#define ICON_CACHE_MAX_AGE         (24*60*60)
+#define ICON_CACHE_NEGATIVE_AGE    (60*60)
+#define ICON_MEMORY_CACHE_SIZE     256
+#define TIMELINE_CACHE_MAX_SIZE    (4*1024*1024)
+#define SHORT_URL_CACHE_MAX_SIZE   (256*1024)
+#define SHORT_URL_CACHE_MAX_AGE    (30*24*60*60)
+#define SHORTEN_TIMER_SPAN         800
+#define OUTBOX_NOTIFY_SPAN         200
+#define STATUS_STORE_MAX_SIZE      (8*1024*1024)
+#define PRECONNECT_ICON_HOSTS      4
+#define COMBINED_TIMELINE_URL      "combined:"
+#define COMBINED_DEFAULT_SOURCES   "friends,self"
+#define COMBINED_MAX_SOURCES       8
+#define STARTUP_MAX_PHASES         16
+#define ICON_SIZE                  32
+#define TIMELINE_MAX_STATUSES      200
+#define TIMELINE_MAX_LIST_STATUSES 10000
+#define TIMELINE_POLL_COUNT        200
 
 static GdkCursor* hand_cursor = NULL;
 static GdkCursor* regular_cursor = NULL;
 static GdkCursor* watch_cursor = NULL;
 
 typedef struct _PIXBUF_CACHE {
-	char* id;
+	char* url;
+	char* mime;		/* of the body in icon cache, to revalidate */
 	GdkPixbuf* pixbuf;
 } PIXBUF_CACHE;
 
@@ -63,241 +103,101 @@ typedef struct _PROCESS_THREAD_INFO {
  * timer register
  */
 static guint timer_tag = 0;
+static guint reload_span = RELOAD_TIMER_SPAN;
 static void start_reload_timer(GtkWidget* toplevel);
 static void stop_reload_timer(GtkWidget* toplevel);
 static void reset_reload_timer(GtkWidget* toplevel);
+static void schedule_reload(GtkWidget* window, HTTP_RESPONSE* response, gboolean failed, int new_statuses);
 
 static gboolean login_dialog(GtkWidget* window);
 static int load_config(GtkWidget* window);
 static int save_config(GtkWidget* window);
 
-/**
- * curl callback
- */
-static char* response_cond = NULL;	/* response condition */
-static char* response_mime = NULL;	/* response content-type. ex: "text/html" */
-static char* response_data = NULL;	/* response data from server. */
-static size_t response_size = 0;	/* response size of data */
-static char last_condition[256] = {0};
 static int is_processing = FALSE;
+static int icon_fetch_parallel = HTTP_FETCH_PARALLEL;
+static CACHE* icon_cache = NULL;
+static CACHE* timeline_cache = NULL;
+static CACHE* short_url_cache = NULL;
+static GThreadPool* shorten_pool = NULL;
+static guint shorten_timer_tag = 0;
+static gchar* shorten_message = NULL;
+static OUTBOX* outbox = NULL;
+static gint outbox_notify_pending = 0;
+static gint post_refresh_pending = 0;
+static GAsyncQueue* posted_statuses = NULL;
+static STATUS_STORE* status_store = NULL;
+static int use_status_view = FALSE;
+
+/* timeline being shown, and the newest status in it */
+static char timeline_url[2048] = {0};
+static char since_id[64] = {0};
+static LINK_STORE* link_store = NULL;
+/* times of the statuses being shown, from the newest */
+static STATUS_INDEX* status_index = NULL;
 
-static void initialize_http_response() {
-	response_cond = NULL;
-	response_mime = NULL;
-	response_data = NULL;
-	response_size = 0;
-}
-
-static void terminate_http_response() {
-	if (response_cond) free(response_cond);
-	if (response_mime) free(response_mime);
-	if (response_data) free(response_data);
-	response_cond = NULL;
-	response_mime = NULL;
-	response_data = NULL;
-	response_size = 0;
-}
-
-static time_t strtotime(char *s) {
-	char *os;
-	int i;
-	struct tm tm;
-	int isleap;
-
-	static int mday[2][12] = {
-		31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31,
-		31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31,
-	};
-	static char* wday[] = {
-		"Sunday", "Monday", "Tuesday", "Wednesday",
-		"Thursday", "Friday", "Saturday",
-		NULL
-	};
-	static char* mon[] = {
-		"Jan", "Feb", "Mar", "Apr", "May", "Jun",
-		"Jul", "Aug", "Sep", "Oct", "Nov", "Dec",
-		NULL
-	};
-
-	os = s;
-	/* Sunday */
-	for(i = 0; i < sizeof(wday)/sizeof(wday[0]); i++) {
-		if (strncmp(s, wday[i], strlen(wday[i])) == 0) {
-			s += strlen(wday[i]);
-			break;
-		}
-		if (strncmp(s, wday[i], 3) == 0) {
-			s += 3;
-			break;
-		}
-	}
-	if (i == sizeof(wday)/sizeof(wday[0])) return -1;
-	if (*s != ',' && *s != ' ') return -1;
-	s++;
-
-	/* Jan */
-	if (*s != ',' && *s != ' ') return -1;
-	s++;
-
-	/* 25 */
-	tm.tm_mday = atoi(s);
-	while (isdigit(*s)) s++;
-	if (*s != ',' && *s != ' ') return -1;
-	s++;
-
-	/* 00:00:00 */
-	if (!(isdigit(s[0]) && isdigit(s[1]) && s[2] == ':'
-	   && isdigit(s[3]) && isdigit(s[4]) && s[5] == ':'
-	   && isdigit(s[6]) && isdigit(s[7]) && s[8] == ' ')) return -1;
-	tm.tm_hour = atoi(s);
-	tm.tm_min = atoi(s+3);
-	tm.tm_sec = atoi(s+6);
-	if (tm.tm_hour >= 24 || tm.tm_min >= 60 || tm.tm_sec >= 60) return -1;
-	s += 9;
-
-	/* +0000 */
-	if (s[0] == '+' || s[1] == '-') s++;
-	while (isdigit(*s)) s++;
-	if (*s != ',' && *s != ' ') return -1;
-	s++;
-
-	/* 2002 */
-	tm.tm_year = atoi(s) - 1900;
-	/*
-	while (isdigit(*s)) s++;
-	if (*s != ',' && *s != ' ') return -1;
-	s++;
-	*/
+/**
+ * combined timeline
+ *
+ * timelines named in "combined_timelines" of the config ("friends", "self"
+ * or screen names) are fetched at once and merged by time. each of them
+ * keeps its newest status, so a poll only asks each for what is new to it.
+ */
+typedef struct _COMBINED_SOURCE {
+	char* name;
+	char* url;
+	char since_id[64];
+} COMBINED_SOURCE;
 
-	tm.tm_yday = 0;
-	return mktime(&tm);
-}
+static COMBINED_SOURCE combined_sources[COMBINED_MAX_SOURCES];
+static int combined_count = 0;
 
-static size_t handle_returned_data(char* ptr, size_t size, size_t nmemb, void* stream) {
-	if (!response_data)
-		response_data = (char*)malloc(size*nmemb);
-	else
-		response_data = (char*)realloc(response_data, response_size+size*nmemb);
-	if (response_data) {
-		memcpy(response_data+response_size, ptr, size*nmemb);
-		response_size += size*nmemb;
+/**
+ * startup timing
+ *
+ * with --startup-timing, phases are marked from the start of main until
+ * the first refresh finished, then reported on stderr.
+ */
+typedef struct _STARTUP_PHASE {
+	const char* name;
+	double at;
+} STARTUP_PHASE;
+
+static GTimer* startup_timer = NULL;
+static STARTUP_PHASE startup_phases[STARTUP_MAX_PHASES];
+static int startup_count = 0;
+static GStaticMutex startup_lock = G_STATIC_MUTEX_INIT;
+
+static void startup_mark(const char* name) {
+	if (!startup_timer) return;
+	g_static_mutex_lock(&startup_lock);
+	if (startup_timer && startup_count < STARTUP_MAX_PHASES) {
+		startup_phases[startup_count].name = name;
+		startup_phases[startup_count].at = g_timer_elapsed(startup_timer, NULL);
+		startup_count++;
 	}
-	return size*nmemb;
+	g_static_mutex_unlock(&startup_lock);
 }
 
-static size_t handle_returned_header(void* ptr, size_t size, size_t nmemb, void* stream) {
-	char* header = NULL;
+static void startup_report(void) {
+	double last = 0;
+	int n;
 
-	header = malloc(size*nmemb + 1);
-	memcpy(header, ptr, size*nmemb);
-	header[size*nmemb] = 0;
-	if (strncmp(header, "Content-Type: ", 14) == 0) {
-		char* stop = header + 14;
-		stop = strpbrk(header + 14, "\r\n;");
-		if (stop) *stop = 0;
-		if (response_mime) free(response_mime);
-		response_mime = strdup(header + 14);
-	}
-	if (strncmp(header, "Last-Modified: ", 15) == 0) {
-		char* stop = strpbrk(header, "\r\n;");
-		if (stop) *stop = 0;
-		if (response_cond) free(response_cond);
-		response_cond = strdup(header);
+	if (!startup_timer) return;
+	g_static_mutex_lock(&startup_lock);
+	fprintf(stderr, "%-24s %10s %10s\n", "startup phase", "msec", "delta");
+	for(n = 0; n < startup_count; n++) {
+		fprintf(stderr, "%-24s %10.1f %10.1f\n", startup_phases[n].name,
+				startup_phases[n].at*1000, (startup_phases[n].at - last)*1000);
+		last = startup_phases[n].at;
 	}
-	if (strncmp(header, "ETag: ", 6) == 0) {
-		char* stop = strpbrk(header, "\r\n;");
-		if (stop) *stop = 0;
-		if (response_cond) free(response_cond);
-		response_cond = strdup(header);
-	}
-	free(header);
-	return size*nmemb;
+	g_timer_destroy(startup_timer);
+	startup_timer = NULL;
+	g_static_mutex_unlock(&startup_lock);
 }
 
 /**
  * string utilities
  */
-static char* xml_decode_alloc(const char* str) {
-	char* buf = NULL;
-	unsigned char* pbuf = NULL;
-	int len = 0;
-
-	if (!str) return NULL;
-	len = strlen(str)*3;
-	buf = malloc(len+1);
-	memset(buf, 0, len+1);
-	pbuf = (unsigned char*)buf;
-	while(*str) {
-		if (*str == '<') {
-            char* ptr = strchr(str, '>');
-			if (ptr) str = ptr + 1;
-		} else
-		if (!memcmp(str, "&amp;", 5)) {
-			strcat((char*)pbuf++, "&");
-			str += 5;
-		} else
-		if (!memcmp(str, "&nbsp;", 6)) {
-			strcat((char*)pbuf++, " ");
-			str += 6;
-		} else
-		if (!memcmp(str, "&quot;", 6)) {
-			strcat((char*)pbuf++, "\"");
-			str += 6;
-		} else
-		if (!memcmp(str, "&nbsp;", 6)) {
-			strcat((char*)pbuf++, " ");
-			str += 6;
-		} else
-		if (!memcmp(str, "&lt;", 4)) {
-			strcat((char*)pbuf++, "<");
-			str += 4;
-		} else
-		if (!memcmp(str, "&gt;", 4)) {
-			strcat((char*)pbuf++, ">");
-			str += 4;
-		} else
-			*pbuf++ = *str++;
-	}
-	return buf;
-}
-
-static char* get_tiny_url_alloc(const char* url, GError** error) {
-	char api_url[2048];
-	CURLcode res;
-	GError* _error = NULL;
-	CURL* curl;
-	char* ret = NULL;
-	long status = 0;
-
-	snprintf(api_url, sizeof(api_url)-1, "%s/?url=%s", TINYURL_API_URL, url);
-
-	/* initialize callback data */
-	initialize_http_response();
-
-	curl = curl_easy_init();
-	if (!curl) return NULL;
-	curl_easy_setopt(curl, CURLOPT_URL, api_url);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_returned_data);
-	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, handle_returned_header);
-	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
-	curl_easy_setopt(curl, CURLOPT_USERAGENT, APP_NAME);
-	res = curl_easy_perform(curl);
-	res = res == CURLE_OK ? curl_easy_getinfo(curl, CURLINFO_HTTP_CODE, &status) : res;
-	curl_easy_cleanup(curl);
-	if (res == CURLE_OK && status == 200) {
-		ret = malloc(response_size+1);
-		memset(ret, 0, response_size+1);
-		memcpy(ret, (char*)response_data, response_size);
-	}
-	else
-		_error = g_error_new_literal(G_FILE_ERROR, res, curl_easy_strerror(res));
-
-	/* cleanup callback data */
-	terminate_http_response();
-	if (error && _error) *error = _error;
-	return ret;
-}
-
 static char* url_encode_alloc(const char* str, int force_encode) {
 	const char* hex = "0123456789abcdef";
 
@@ -325,104 +225,261 @@ static char* url_encode_alloc(const char* str, int force_encode) {
 	return buf;
 }
 
-char* sanitize_message_alloc(const char* message) {
-	const char* ptr = message;
-	const char* last = ptr;
+/**
+ * shorten urls
+ *
+ * every long url of a message is sent to tinyurl at once. the answers are
+ * kept in short_url_cache, so a link shortened while the message was typed,
+ * or posted before, costs no round trip.
+ */
+static char* cached_short_url_alloc(const char* url) {
+	CACHE_ENTRY* entry;
 	char* ret = NULL;
-	int len = 0;
-	while(*ptr) {
-		if (!strncmp(ptr, "http://", 7) || !strncmp(ptr, "ftp://", 6)) {
-			char* link;
-			char* tiny_url;
-			const char* tmp;
-
-			if (last != ptr) {
-				len += (ptr-last);
-				if (!ret) {
-					ret = malloc(len+1);
-					memset(ret, 0, len+1);
-				} else ret = realloc(ret, len+1);
-				strncat(ret, last, ptr-last);
-			}
 
-			tmp = ptr;
-			while(*tmp && strchr(ACCEPT_LETTER_URL, *tmp)) tmp++;
-			link = malloc(tmp-ptr+1);
-			memset(link, 0, tmp-ptr+1);
-			memcpy(link, ptr, tmp-ptr);
-			tiny_url = get_tiny_url_alloc(link, NULL);
-			if (tiny_url) {
-				free(link);
-				link = tiny_url;
+	if (!short_url_cache) return NULL;
+	entry = cache_lookup(short_url_cache, url);
+	if (entry && entry->status == 200 && entry->expires > time(NULL)) {
+		size_t size = 0;
+		char* data = cache_read(short_url_cache, url, &size);
+		if (data && size) {
+			ret = malloc(size+1);
+			memcpy(ret, data, size);
+			ret[size] = 0;
+		}
+		g_free(data);
+	}
+	cache_entry_free(entry);
+	return ret;
+}
+
+static void shorten_urls(GPtrArray* urls, char** short_urls) {
+	HTTP_FETCH* fetches;
+	time_t now = time(NULL);
+	int count = urls->len;
+	int nfetch = 0;
+	int n, m;
+
+	fetches = malloc(count*sizeof(HTTP_FETCH));
+	memset(fetches, 0, count*sizeof(HTTP_FETCH));
+	for(n = 0; n < count; n++) {
+		const char* url = (const char*)g_ptr_array_index(urls, n);
+		short_urls[n] = cached_short_url_alloc(url);
+		if (short_urls[n]) continue;
+		/* same url twice in a message is asked once */
+		for(m = 0; m < nfetch; m++)
+			if (!strcmp(url, (const char*)g_ptr_array_index(urls, GPOINTER_TO_INT(fetches[m].user_data)))) break;
+		if (m < nfetch) continue;
+		fetches[nfetch].url = malloc(strlen(TINYURL_API_URL) + strlen(url) + 7);
+		sprintf(fetches[nfetch].url, "%s/?url=%s", TINYURL_API_URL, url);
+		fetches[nfetch].user_data = GINT_TO_POINTER(n);
+		http_response_init(&fetches[nfetch].response);
+		nfetch++;
+	}
+	if (nfetch == 0) {
+		free(fetches);
+		return;
+	}
+
+	http_fetch_all(fetches, nfetch, HTTP_FETCH_PARALLEL);
+
+	for(m = 0; m < nfetch; m++) {
+		HTTP_RESPONSE* response = &fetches[m].response;
+		n = GPOINTER_TO_INT(fetches[m].user_data);
+		if (fetches[m].result != CURLE_OK || response->status != 200 || !response->size) continue;
+		if (short_url_cache)
+			cache_store(short_url_cache, (const char*)g_ptr_array_index(urls, n), 200, NULL, NULL, NULL,
+				now + SHORT_URL_CACHE_MAX_AGE, response->data, response->size);
+		short_urls[n] = http_response_steal_data(response);
+	}
+	http_fetch_free(fetches, nfetch);
+	if (short_url_cache) cache_save(short_url_cache);
+
+	for(n = 0; n < count; n++) {
+		if (short_urls[n]) continue;
+		for(m = 0; m < n; m++) {
+			if (short_urls[m] && !strcmp((const char*)g_ptr_array_index(urls, n), (const char*)g_ptr_array_index(urls, m))) {
+				size_t len = strlen(short_urls[m]);
+				short_urls[n] = malloc(len+1);
+				memcpy(short_urls[n], short_urls[m], len+1);
+				break;
 			}
+		}
+	}
+}
 
-			len += strlen(link);
-			if (!ret) {
-				ret = malloc(len+1);
-				memset(ret, 0, len+1);
-			} else ret = realloc(ret, len+1);
-			strcat(ret, link);
-			free(link);
-			ptr = last = tmp;
-		} else
-			ptr++;
+/**
+ * urls of the message, in the order of the url tokens.
+ */
+static GPtrArray* message_urls_new(const char* message, GArray* tokens) {
+	GPtrArray* urls = g_ptr_array_new();
+	guint n;
+
+	status_text_tokenize(message, STATUS_TEXT_URLS, tokens);
+	for(n = 0; n < tokens->len; n++) {
+		STATUS_TOKEN* token = &g_array_index(tokens, STATUS_TOKEN, n);
+		char* link;
+		if (token->kind != STATUS_TOKEN_URL) continue;
+		link = malloc(token->len+1);
+		memcpy(link, token->text, token->len);
+		link[token->len] = 0;
+		g_ptr_array_add(urls, link);
+	}
+	return urls;
+}
+
+static void message_urls_free(GPtrArray* urls, char** short_urls) {
+	guint n;
+	for(n = 0; n < urls->len; n++) {
+		free(g_ptr_array_index(urls, n));
+		if (short_urls && short_urls[n]) free(short_urls[n]);
+	}
+	g_ptr_array_free(urls, TRUE);
+	if (short_urls) free(short_urls);
+}
+
+char* sanitize_message_alloc(const char* message) {
+	GArray* tokens = g_array_new(FALSE, FALSE, sizeof(STATUS_TOKEN));
+	GString* sanitized = g_string_new(NULL);
+	GPtrArray* urls;
+	char** short_urls = NULL;
+	char* ret = NULL;
+	guint n, url = 0;
+
+	urls = message_urls_new(message, tokens);
+	if (urls->len) {
+		short_urls = malloc(urls->len*sizeof(char*));
+		shorten_urls(urls, short_urls);
+	}
+	for(n = 0; n < tokens->len; n++) {
+		STATUS_TOKEN* token = &g_array_index(tokens, STATUS_TOKEN, n);
+		if (token->kind != STATUS_TOKEN_URL) {
+			g_string_append_len(sanitized, token->text, token->len);
+			continue;
+		}
+		if (short_urls[url])
+			g_string_append(sanitized, short_urls[url]);
+		else
+			g_string_append_len(sanitized, token->text, token->len);
+		url++;
 	}
-	if (last != ptr) {
-		len += (ptr-last);
-		if (!ret) {
-			ret = malloc(len+1);
-			memset(ret, 0, len+1);
-		} else ret = realloc(ret, len+1);
-		strncat(ret, last, ptr-last);
+	if (sanitized->len) {
+		ret = malloc(sanitized->len+1);
+		memcpy(ret, sanitized->str, sanitized->len+1);
 	}
+	message_urls_free(urls, short_urls);
+	g_string_free(sanitized, TRUE);
+	g_array_free(tokens, TRUE);
 	return ret;
 }
 
+/**
+ * urls are shortened in background while the message is typed. the text is
+ * taken when the entry is changed, handed over when the entry was left
+ * alone for SHORTEN_TIMER_SPAN, and only the last text waiting is looked
+ * at. shorten_message and the timer belong to main loop, so the timer never
+ * needs the lock.
+ */
+static void prefetch_short_urls(gpointer data, gpointer user_data) {
+	char* message = (char*)data;
+	GArray* tokens;
+	GPtrArray* urls;
+	char** short_urls = NULL;
+
+	if (g_thread_pool_unprocessed(shorten_pool) > 0) {
+		/* newer text is waiting */
+		g_free(message);
+		return;
+	}
+	tokens = g_array_new(FALSE, FALSE, sizeof(STATUS_TOKEN));
+	urls = message_urls_new(message, tokens);
+	if (urls->len) {
+		short_urls = malloc(urls->len*sizeof(char*));
+		shorten_urls(urls, short_urls);
+	}
+	message_urls_free(urls, short_urls);
+	g_array_free(tokens, TRUE);
+	g_free(message);
+}
+
+static gboolean shorten_timer(gpointer data) {
+	shorten_timer_tag = 0;
+	if (shorten_pool)
+		g_thread_pool_push(shorten_pool, shorten_message, NULL);
+	else
+		g_free(shorten_message);
+	shorten_message = NULL;
+	return FALSE;
+}
+
+static void stop_shorten_timer(void) {
+	if (shorten_timer_tag != 0) g_source_remove(shorten_timer_tag);
+	shorten_timer_tag = 0;
+	g_free(shorten_message);
+	shorten_message = NULL;
+}
+
+static void on_entry_changed(GtkWidget* widget, gpointer user_data) {
+	const char* message = gtk_entry_get_text(GTK_ENTRY(widget));
+
+	stop_shorten_timer();
+	if (!message || !strstr(message, "://")) return;
+	shorten_message = g_strdup(message);
+	shorten_timer_tag = g_timeout_add(SHORTEN_TIMER_SPAN, shorten_timer, NULL);
+}
+
 /**
  * loading icon
  */
-static GdkPixbuf* url2pixbuf(const char* url, GError** error) {
+static GdkPixbuf* data2pixbuf(const char* data, size_t size, const char* mime, GError** error) {
 	GdkPixbuf* pixbuf = NULL;
 	GdkPixbufLoader* loader = NULL;
-	GdkPixbufFormat* format = NULL;
+
+	if (mime) loader = (GdkPixbufLoader*)gdk_pixbuf_loader_new_with_mime_type(mime, NULL);
+	if (!loader) loader = gdk_pixbuf_loader_new();
+	if (gdk_pixbuf_loader_write(loader, (const guchar*)data, size, error)) {
+		gdk_pixbuf_loader_close(loader, NULL);
+		pixbuf = gdk_pixbuf_loader_get_pixbuf(loader);
+		if (pixbuf) g_object_ref(pixbuf);
+	} else
+		gdk_pixbuf_loader_close(loader, NULL);
+	g_object_unref(loader);
+	return pixbuf;
+}
+
+static GdkPixbuf* url2pixbuf(const char* url, GError** error) {
+	GdkPixbuf* pixbuf = NULL;
 	GError* _error = NULL;
 	CURL* curl = NULL;
 	CURLcode res = CURLE_OK;
+	HTTP_RESPONSE response;
 
 	/* initialize callback data */
-	initialize_http_response();
+	http_response_init(&response);
 
 	if (!strncmp(url, "file:///", 8) || g_file_test(url, G_FILE_TEST_EXISTS)) {
 		gchar* newurl = g_filename_from_uri(url, NULL, NULL);
 		pixbuf = gdk_pixbuf_new_from_file(newurl ? newurl : url, &_error);
 	} else {
 		char *url_escaped;
-		curl = curl_easy_init();
-		if (!curl) return NULL;
 		url_escaped = url_encode_alloc(url, FALSE);
 		if (!url_escaped) return NULL;
+		curl = http_engine_acquire(url_escaped);
+		if (!curl) {
+			free(url_escaped);
+			return NULL;
+		}
 		curl_easy_setopt(curl, CURLOPT_URL, url_escaped);
-		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_returned_data);
-		curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, handle_returned_header);
-		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
-		curl_easy_setopt(curl, CURLOPT_USERAGENT, APP_NAME);
-		res = curl_easy_perform(curl);
-		curl_easy_cleanup(curl);
+		res = http_perform(curl, &response);
+		http_engine_release(curl);
 		free(url_escaped);
-		if (res == CURLE_OK) {
-			if (response_mime) loader = (GdkPixbufLoader*)gdk_pixbuf_loader_new_with_mime_type(response_mime, error);
-			if (!loader) loader = gdk_pixbuf_loader_new();
-			if (gdk_pixbuf_loader_write(loader, (const guchar*)response_data, response_size, &_error)) {
-				pixbuf = gdk_pixbuf_loader_get_pixbuf(loader);
-				format = gdk_pixbuf_loader_get_format(loader);
-			}
-			gdk_pixbuf_loader_close(loader, NULL);
-		} else
+		if (res == CURLE_OK)
+			pixbuf = data2pixbuf(response.data, response.size, response.mime, &_error);
+		else
 			_error = g_error_new_literal(G_FILE_ERROR, res, curl_easy_strerror(res));
 	}
 
 	/* cleanup callback data */
-	terminate_http_response();
+	http_response_clear(&response);
 	if (error && _error) *error = _error;
 	return pixbuf;
 }
@@ -511,412 +568,1457 @@ static void error_dialog(GtkWidget* widget, const char* message) {
 	gtk_widget_destroy(dialog);
 }
 
-static void insert_status_text(GtkTextBuffer* buffer, GtkTextIter* iter, const char* status) {
-	char* ptr = (char*)status;
-	char* last = ptr;
-	if (!status) return;
-	while(*ptr) {
-		if (!strncmp(ptr, "http://", 7) || !strncmp(ptr, "ftp://", 6)) {
-			GtkTextTag *tag;
-			int len;
-			char* link;
-			char* tmp;
-			gchar* url;
-
-			if (last != ptr)
-				gtk_text_buffer_insert(buffer, iter, last, ptr-last);
-
-			tmp = ptr;
-			while(*tmp && strchr(ACCEPT_LETTER_URL, *tmp)) tmp++;
-			len = (int)(tmp-ptr);
-			link = malloc(len+1);
-			memset(link, 0, len+1);
-			strncpy(link, ptr, len);
-			tag = gtk_text_buffer_create_tag(
-					buffer,
-					NULL, 
-					"foreground",
-					"blue", 
-					"underline",
-					PANGO_UNDERLINE_SINGLE, 
-					NULL);
-			url = g_strdup(link);
-			g_object_set_data(G_OBJECT(tag), "url", (gpointer)url);
-			gtk_text_buffer_insert_with_tags(buffer, iter, link, -1, tag, NULL);
-			free(link);
-			ptr = last = tmp;
-		} else
-		if (*ptr == '@' || !strncmp(ptr, "\xef\xbc\xa0", 3)) {
-			GtkTextTag *tag;
-			int len;
-			char* link;
-			char* tmp;
-			gchar* url;
-			gchar* user_id;
-			gchar* user_name;
-
-			if (last != ptr)
-				gtk_text_buffer_insert(buffer, iter, last, ptr-last);
-
-			user_name = tmp = ptr + (*ptr == '@' ? 1 : 3);
-			while(*tmp && strchr(ACCEPT_LETTER_NAME, *tmp)) tmp++;
-			len = (int)(tmp-user_name);
-			if (len) {
-				link = malloc(len+1);
-				memset(link, 0, len+1);
-				strncpy(link, user_name, len);
-				url = g_strdup_printf("@%s", link);
-				user_id = g_strdup(link);
-				user_name = g_strdup(link);
-				free(link);
-				tag = gtk_text_buffer_create_tag(
-						buffer,
-						NULL, 
-						"foreground",
-						"blue", 
-						"underline",
-						PANGO_UNDERLINE_SINGLE, 
-						NULL);
-				g_object_set_data(G_OBJECT(tag), "user_id", (gpointer)user_id);
-				g_object_set_data(G_OBJECT(tag), "user_name", (gpointer)user_name);
-				gtk_text_buffer_insert_with_tags(buffer, iter, url, -1, tag, NULL);
-				g_free(url);
-				ptr = last = tmp;
-			} else
-				ptr = tmp;
-		} else
-#ifdef USE_REPLAY_ACCESS
-		if (!strncmp(ptr, ">>", 2)) {
-			GtkTextTag *tag;
-			int len;
-			char* link;
-			char* tmp;
-			gchar* url;
-
-			if (last != ptr)
-				gtk_text_buffer_insert(buffer, iter, last, ptr-last);
-
-			url = tmp = ptr + 2;
-			while(*tmp && strchr(ACCEPT_LETTER_REPLY, *tmp)) tmp++;
-			len = (int)(tmp-url);
-			if (len) {
-				link = malloc(len+1);
-				memset(link, 0, len+1);
-				strncpy(link, url, len);
-				url = g_strdup_printf(">>%s", link);
-				free(link);
-				tag = gtk_text_buffer_create_tag(
-						buffer,
-						NULL, 
-						"foreground",
-						"blue", 
-						"underline",
-						PANGO_UNDERLINE_SINGLE, 
-						NULL);
-				g_object_set_data(G_OBJECT(tag), "url", (gpointer)url);
-				gtk_text_buffer_insert_with_tags(buffer, iter, url, -1, tag, NULL);
-				ptr = last = tmp;
-			} else
-				ptr = tmp;
-		} else
-#endif
-			ptr++;
-	}
-	if (last != ptr)
-		gtk_text_buffer_insert(buffer, iter, last, ptr-last);
-}
-
 /**
- * update friends statuses
+ * status text made ready to insert: the decoded text split into plain text
+ * and links, in order. strings are kept in one chunk.
  */
-static gpointer update_friends_statuses_thread(gpointer data) {
-	GtkWidget* window = (GtkWidget*)data;
-	GtkTextBuffer* buffer = NULL;
-	GtkTextTag* name_tag = NULL;
-	GtkTextTag* date_tag = NULL;
-	CURL* curl = NULL;
-	CURLcode res = CURLE_OK;
-	struct curl_slist *headers = NULL;
-	long status = 0;
-	gchar* user_id = NULL;
-	gchar* user_name = NULL;
-	gchar* status_id = NULL;
-	gchar* title = NULL;
+typedef struct _STATUS_SPAN {
+	const char* text;
+	int len;
+	const char* link;
+} STATUS_SPAN;
 
-	char url[2048];
-	char auth[512];
-	char* recv_data = NULL;
-	char* mail = NULL;
-	char* pass = NULL;
-	int n;
-	int length;
-	gpointer result_str = NULL;
+typedef struct _STATUS_SPANS {
+	GArray* spans;
+	GStringChunk* strings;
+} STATUS_SPANS;
 
-	xmlDocPtr doc = NULL;
-	xmlNodeSetPtr nodes = NULL;
-	xmlXPathContextPtr ctx = NULL;
-	xmlXPathObjectPtr path = NULL;
+/**
+ * link of a mention is "@name" and of a reply ">>status_id", also when the
+ * text had a fullwidth at sign.
+ */
+static void collect_status_span(STATUS_SPANS* spans, STATUS_TOKEN* token, GString* scratch) {
+	STATUS_SPAN span;
+
+	switch (token->kind) {
+	case STATUS_TOKEN_MENTION:
+	case STATUS_TOKEN_REPLY:
+		g_string_assign(scratch, token->kind == STATUS_TOKEN_MENTION ? "@" : ">>");
+		g_string_append_len(scratch, token->value, token->value_len);
+		span.text = span.link = g_string_chunk_insert_len(spans->strings, scratch->str, scratch->len);
+		span.len = scratch->len;
+		break;
+	case STATUS_TOKEN_URL:
+		span.text = span.link = g_string_chunk_insert_len(spans->strings, token->text, token->len);
+		span.len = token->len;
+		break;
+	default:
+		span.text = g_string_chunk_insert_len(spans->strings, token->text, token->len);
+		span.len = token->len;
+		span.link = NULL;
+		break;
+	}
+	g_array_append_val(spans->spans, span);
+}
 
-	GtkTextIter iter;
+static STATUS_SPANS* status_spans_new(const char* status) {
+	STATUS_SPANS* spans = g_new0(STATUS_SPANS, 1);
+	char* text = entity_decode_alloc(status, ENTITY_STRIP_MARKUP);
+	GArray* tokens = g_array_new(FALSE, FALSE, sizeof(STATUS_TOKEN));
+	GString* scratch = g_string_new(NULL);
+	guint n;
+
+	spans->spans = g_array_new(FALSE, FALSE, sizeof(STATUS_SPAN));
+	spans->strings = g_string_chunk_new(256);
+	status_text_tokenize(text, STATUS_TEXT_LINKS, tokens);
+	for(n = 0; n < tokens->len; n++)
+		collect_status_span(spans, &g_array_index(tokens, STATUS_TOKEN, n), scratch);
+	g_string_free(scratch, TRUE);
+	g_array_free(tokens, TRUE);
+	if (text) free(text);
+	return spans;
+}
 
-	PIXBUF_CACHE* pixbuf_cache = NULL;
+static void status_spans_free(STATUS_SPANS* spans) {
+	if (!spans) return;
+	g_array_free(spans->spans, TRUE);
+	g_string_chunk_free(spans->strings);
+	g_free(spans);
+}
 
-	/* making basic auth info */
-	gdk_threads_enter();
-	mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
-	pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
-	gdk_threads_leave();
+static void insert_status_text(GtkTextBuffer* buffer, GtkTextIter* iter, LINK_RENDER* render, STATUS_SPANS* spans) {
+	GtkTextTag* link_tag = gtk_text_tag_table_lookup(gtk_text_buffer_get_tag_table(buffer), "link_tag");
+	guint n;
 
-	memset(url, 0, sizeof(url));
-	user_id = g_object_get_data(G_OBJECT(window), "user_id");
-	user_name = g_object_get_data(G_OBJECT(window), "user_name");
-	status_id = g_object_get_data(G_OBJECT(window), "status_id");
-	if (status_id) {
-		snprintf(url, sizeof(url)-1, SERVICE_THREAD_STATUS_URL, status_id);
-		/* status_id is temporary value */
-		g_free(status_id);
-		g_object_set_data(G_OBJECT(window), "status_id", NULL);
+	for(n = 0; n < spans->spans->len; n++) {
+		STATUS_SPAN* span = &g_array_index(spans->spans, STATUS_SPAN, n);
+		int start;
+		if (!span->link) {
+			gtk_text_buffer_insert(buffer, iter, span->text, span->len);
+			continue;
+		}
+		start = gtk_text_iter_get_offset(iter);
+		gtk_text_buffer_insert_with_tags(buffer, iter, span->text, span->len, link_tag, NULL);
+		if (*span->link == '@')
+			link_render_add(render, start, gtk_text_iter_get_offset(iter), NULL, span->link+1, span->link+1, NULL);
+		else
+			link_render_add(render, start, gtk_text_iter_get_offset(iter), span->link, NULL, NULL, NULL);
 	}
-	else
-	if (user_id)
-		snprintf(url, sizeof(url)-1, SERVICE_USER_STATUS_URL, user_id);
-	else
-		strncpy(url, SERVICE_SELF_STATUS_URL, sizeof(url)-1);
-	memset(auth, 0, sizeof(auth));
-	snprintf(auth, sizeof(auth)-1, "%s:%s", mail, pass);
+}
 
-	/* initialize callback data */
-	initialize_http_response();
+static void append_status_text(STATUS_ROW* row, STATUS_SPANS* spans) {
+	guint n;
 
-	/* perform http */
-	curl = curl_easy_init();
-	curl_easy_setopt(curl, CURLOPT_URL, url);
-	curl_easy_setopt(curl, CURLOPT_USERPWD, auth);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_returned_data);
-	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, handle_returned_header);
-	if (last_condition[0] != 0) {
-		headers = curl_slist_append(headers, last_condition);
-		curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+	for(n = 0; n < spans->spans->len; n++) {
+		STATUS_SPAN* span = &g_array_index(spans->spans, STATUS_SPAN, n);
+		status_row_append(row, span->text, span->len, span->link,
+				span->link && *span->link == '@' ? span->link+1 : NULL);
 	}
-	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
-	curl_easy_setopt(curl, CURLOPT_USERAGENT, APP_NAME);
-	res = curl_easy_perform(curl);
-	res == CURLE_OK ? curl_easy_getinfo(curl, CURLINFO_HTTP_CODE, &status) : res;
-	curl_easy_cleanup(curl);
-	if (headers) curl_slist_free_all(headers);
+}
 
-	if (status == 0) {
-		result_str = g_strdup(_("no server response"));
-		goto leave;
-	}
-	recv_data = malloc(response_size+1);
-	memset(recv_data, 0, response_size+1);
-	memcpy(recv_data, response_data, response_size);
-	if (status == 304)
-		goto leave;
-	if (response_mime && strcmp(response_mime, "application/xml")) {
-		result_str = g_strdup(_("unknown server response"));
-		goto leave;
-	}
-	if (status != 200) {
-		/* failed to get xml */
-		if (response_data) {
-			char* message = xml_decode_alloc(recv_data);
-			result_str = g_strdup(message);
-			free(message);
-		} else
-			result_str = g_strdup(_("unknown server response"));
-		if (status == 401) {
-			if (mail) free(mail);
-			if (pass) free(pass);
-			g_object_set_data(G_OBJECT(window), "mail", NULL);
-			g_object_set_data(G_OBJECT(window), "pass", NULL);
-		}
-		goto leave;
-	}
-	if (response_cond) {
-		if (!strncmp(response_cond, "ETag: ", 6))
-			sprintf(last_condition, "If-None-Match: %s", response_cond+6);
-		else
-		if (!strncmp(response_cond, "Last-Modified: ", 15))
-			sprintf(last_condition, "If-Modified-Since: %s", response_cond+15);
-	}
+/**
+ * created_at is parsed once when the timeline arrives. the timeline is put
+ * in order by it.
+ */
+static time_t* status_times_new(GPtrArray* statuses) {
+	time_t* times = malloc((statuses->len+1)*sizeof(time_t));
+	guint n;
+
+	for(n = 0; n < statuses->len; n++)
+		times[n] = status_time_parse(((STATUS_INFO*)g_ptr_array_index(statuses, n))->date);
+	status_time_sort(statuses, times);
+	return times;
+}
 
-	/* parse xml */
-	doc = xmlParseDoc((xmlChar*)recv_data);
-	if (!doc) {
-		if (recv_data)
-			result_str = g_strdup(recv_data);
-		else
-			result_str = g_strdup(_("unknown server response"));
-		goto leave;
-	}
+/**
+ * how long ago the status was posted. older ones show the local time.
+ */
+static void format_status_time(STATUS_INFO* info, time_t time, time_t now, char* buf, size_t size) {
+	long ago = (long)(now - time);
+	struct tm tm;
 
-	/* create xpath query */
-	ctx = xmlXPathNewContext(doc);
-	if (!ctx) {
-		result_str = g_strdup(_("unknown server response"));
-		goto leave;
-	}
-	path = xmlXPathEvalExpression((xmlChar*)"/statuses/status", ctx);
-	if (!path) {
-		result_str = g_strdup(_("unknown server response"));
-		goto leave;
+	if (time == (time_t)-1) {
+		/* as the server sent */
+		strncpy(buf, info->date ? info->date : "", size-1);
+		buf[size-1] = 0;
+		return;
 	}
-	nodes = path->nodesetval;
-
-	if (user_name)
-		title = g_strdup_printf("%s - %s", APP_TITLE, user_name);
+	if (ago < 60)
+		snprintf(buf, size, "%s", _("less than a minute ago"));
 	else
-	if (user_id)
-		title = g_strdup_printf("%s - (%s)", APP_TITLE, user_id);
+	if (ago < 120)
+		snprintf(buf, size, "%s", _("about a minute ago"));
 	else
-		title = g_strdup(APP_TITLE);
-	gtk_window_set_title(GTK_WINDOW(window), title);
-	g_free(title);
+	if (ago < 3600)
+		snprintf(buf, size, _("%ld minutes ago"), ago / 60);
+	else
+	if (ago < 7200)
+		snprintf(buf, size, "%s", _("about an hour ago"));
+	else
+	if (ago < 86400)
+		snprintf(buf, size, _("about %ld hours ago"), ago / 3600);
+	else {
+		status_time_local(time, &tm);
+		if (!strftime(buf, size, "%Y/%m/%d %H:%M", &tm)) *buf = 0;
+	}
+}
 
-	gdk_threads_enter();
-	buffer = (GtkTextBuffer*)g_object_get_data(G_OBJECT(window), "buffer");
-	date_tag = (GtkTextTag*)g_object_get_data(G_OBJECT(buffer), "date_tag");
-	gtk_text_buffer_set_text(buffer, "", 0);
-	gtk_text_buffer_get_iter_at_mark(buffer, &iter, gtk_text_buffer_get_insert(buffer));
-	gdk_threads_leave();
+/**
+ * preprocess statuses on all processors. only inserting into the buffer is
+ * left to the refresh thread.
+ */
+typedef struct _PREPROCESS_INFO {
+	GPtrArray* statuses;
+	time_t* times;
+	time_t now;
+	GdkPixbuf** icons;
+	STATUS_SPANS** spans;
+	STATUS_ROW** rows;
+} PREPROCESS_INFO;
+
+static int get_processor_count(void) {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int)count : 1;
+#endif
+}
 
-	/* allocate pixbuf cache buffer */
-	length = xmlXPathNodeSetGetLength(nodes);
-	pixbuf_cache = malloc(length*sizeof(PIXBUF_CACHE));
-	memset(pixbuf_cache, 0, length*sizeof(PIXBUF_CACHE));
+static void preprocess_status(gpointer data, gpointer user_data) {
+	PREPROCESS_INFO* info = (PREPROCESS_INFO*)user_data;
+	int n = GPOINTER_TO_INT(data) - 1;
+	STATUS_INFO* status = (STATUS_INFO*)g_ptr_array_index(info->statuses, n);
 
-	/* make the friends timelines */
-	for(n = 0; n < length; n++) {
-		char* id = NULL;
-		char* icon = NULL;
-		char* real = NULL;
-		char* name = NULL;
-		char* text = NULL;
-		char* desc = NULL;
-		char* date = NULL;
-		GdkPixbuf* pixbuf = NULL;
-		int cache;
-		//time_t dt;
-
-		/* status nodes */
-		xmlNodePtr status = nodes->nodeTab[n];
-		if (status->type != XML_ATTRIBUTE_NODE && status->type != XML_ELEMENT_NODE && status->type != XML_CDATA_SECTION_NODE) continue;
-		status = status->children;
-		while(status) {
-			if (!strcmp("created_at", (char*)status->name)) date = (char*)status->children->content;
-			if (!strcmp("text", (char*)status->name)) {
-				if (status->children) text = (char*)status->children->content;
-			}
-			/* user nodes */
-			if (!strcmp("user", (char*)status->name)) {
-				xmlNodePtr user = status->children;
-				while(user) {
-					if (!strcmp("id", (char*)user->name)) id = XML_CONTENT(user);
-					if (!strcmp("name", (char*)user->name)) real = XML_CONTENT(user);
-					if (!strcmp("screen_name", (char*)user->name)) name = XML_CONTENT(user);
-					if (!strcmp("profile_image_url", (char*)user->name)) {
-						icon = XML_CONTENT(user);
-						icon = (char*)g_strchomp((gchar*)icon);
-						icon = (char*)g_strchug((gchar*)icon);
-					}
-					if (!strcmp("description", (char*)user->name)) desc = XML_CONTENT(user);
-					user = user->next;
-				}
-			}
-			status = status->next;
-		}
+	char date[64];
 
-		/**
-		 * avoid to duplicate downloading of icon.
-		 */
-		for(cache = 0; cache < length; cache++) {
-			if (!pixbuf_cache[cache].id) break;
-			if (!strcmp(pixbuf_cache[cache].id, id)) {
-				pixbuf = pixbuf_cache[cache].pixbuf;
-				break;
-			}
+	info->spans[n] = status_spans_new(status->text);
+	if (!info->rows) return;
+	format_status_time(status, info->times[n], info->now, date, sizeof(date));
+	info->rows[n] = status_row_new(info->icons[n], status->id, status->name, status->real, date);
+	append_status_text(info->rows[n], info->spans[n]);
+}
+
+static void preprocess_statuses(PREPROCESS_INFO* info) {
+	GThreadPool* pool = NULL;
+	int processors = get_processor_count();
+	int length = info->statuses->len;
+	int n;
+
+	if (processors > 1 && length > 1)
+		pool = g_thread_pool_new(preprocess_status, info, MIN(processors, length), FALSE, NULL);
+	for(n = 0; n < length; n++) {
+		/* index is shifted because NULL can't be pushed */
+		if (pool)
+			g_thread_pool_push(pool, GINT_TO_POINTER(n + 1), NULL);
+		else
+			preprocess_status(GINT_TO_POINTER(n + 1), info);
+	}
+	/* wait for all tasks */
+	if (pool) g_thread_pool_free(pool, FALSE, TRUE);
+}
+
+/**
+ * body of a whole timeline is kept to answer "304 Not Modified" later.
+ */
+typedef struct _TIMELINE_SINK {
+	STATUS_PARSER* parser;
+	GString* body;
+} TIMELINE_SINK;
+
+static gboolean feed_status_parser(const char* data, size_t size, gpointer user_data) {
+	TIMELINE_SINK* sink = (TIMELINE_SINK*)user_data;
+	if (sink->body) g_string_append_len(sink->body, data, size);
+	return status_parser_feed(sink->parser, data, size);
+}
+
+static void append_status(STATUS_INFO* info, gpointer user_data) {
+	g_ptr_array_add((GPtrArray*)user_data, info);
+}
+
+/**
+ * pixbuf from the body kept in icon cache.
+ */
+static GdkPixbuf* cached_icon_pixbuf(const char* url, const char* mime) {
+	GdkPixbuf* pixbuf = NULL;
+	size_t size = 0;
+	char* data = cache_read(icon_cache, url, &size);
+
+	if (!data) return NULL;
+	pixbuf = data2pixbuf(data, size, mime, NULL);
+	g_free(data);
+	if (!pixbuf) cache_remove(icon_cache, url);
+	return pixbuf;
+}
+
+static time_t icon_expires(HTTP_RESPONSE* response, time_t now) {
+	if (response->status != 200 && response->status != 304)
+		return now + ICON_CACHE_NEGATIVE_AGE;
+	if (response->max_age >= 0)
+		return now + response->max_age;
+	return now + ICON_CACHE_MAX_AGE;
+}
+
+static void store_icon_response(PIXBUF_CACHE* cache, HTTP_RESPONSE* response, time_t now) {
+	if (response->status == 404 || response->status == 410) {
+		if (icon_cache)
+			cache_store(icon_cache, cache->url, response->status, NULL, NULL, NULL,
+				icon_expires(response, now), NULL, 0);
+		return;
+	}
+	if (response->status != 200 || !response->data) return;
+	cache->pixbuf = data2pixbuf(response->data, response->size, response->mime, NULL);
+	if (cache->pixbuf && icon_cache)
+		cache_store(icon_cache, cache->url, response->status,
+			response->etag, response->last_modified, response->mime,
+			icon_expires(response, now), response->data, response->size);
+}
+
+/**
+ * download every distinct icon of the timeline at once.
+ */
+static void fetch_icon_pixbufs(PIXBUF_CACHE* pixbuf_cache, int count) {
+	HTTP_FETCH* fetches;
+	PIXBUF_CACHE** refetch;
+	time_t now = time(NULL);
+	int nfetch = 0;
+	int nrefetch = 0;
+	int n;
+
+	fetches = malloc(count*sizeof(HTTP_FETCH));
+	memset(fetches, 0, count*sizeof(HTTP_FETCH));
+	for(n = 0; n < count; n++) {
+		char* url = pixbuf_cache[n].url;
+		CACHE_ENTRY* entry = NULL;
+		if (!strncmp(url, "file:///", 8) || g_file_test(url, G_FILE_TEST_EXISTS)) {
+			pixbuf_cache[n].pixbuf = url2pixbuf(url, NULL);
+			continue;
 		}
-		if (!pixbuf) {
-			pixbuf = url2pixbuf((char*)icon, NULL);
-			if (pixbuf) {
-				pixbuf_cache[cache].id = id;
-				pixbuf_cache[cache].pixbuf = pixbuf;
+		if (icon_cache) entry = cache_lookup(icon_cache, url);
+		if (entry && entry->expires > now) {
+			/* fresh. "not found" is also remembered for a while */
+			if (entry->status == 200)
+				pixbuf_cache[n].pixbuf = cached_icon_pixbuf(url, entry->mime);
+			if (entry->status != 200 || pixbuf_cache[n].pixbuf) {
+				cache_entry_free(entry);
+				continue;
+			}
+		} else
+		if (entry && entry->status == 200) {
+			/* stale. ask the server whether it was changed */
+			char header[512];
+			if (entry->etag) {
+				snprintf(header, sizeof(header), "If-None-Match: %s", entry->etag);
+				fetches[nfetch].headers = curl_slist_append(fetches[nfetch].headers, header);
 			}
+			if (entry->last_modified) {
+				snprintf(header, sizeof(header), "If-Modified-Since: %s", entry->last_modified);
+				fetches[nfetch].headers = curl_slist_append(fetches[nfetch].headers, header);
+			}
+			/* "304 Not Modified" has no type of its own */
+			pixbuf_cache[n].mime = g_strdup(entry->mime);
+		}
+		cache_entry_free(entry);
+		fetches[nfetch].url = url_encode_alloc(url, FALSE);
+		fetches[nfetch].user_data = &pixbuf_cache[n];
+		http_response_init(&fetches[nfetch].response);
+		nfetch++;
+	}
+
+	http_fetch_all(fetches, nfetch, icon_fetch_parallel);
+
+	refetch = malloc((nfetch ? nfetch : 1)*sizeof(PIXBUF_CACHE*));
+	for(n = 0; n < nfetch; n++) {
+		PIXBUF_CACHE* cache = (PIXBUF_CACHE*)fetches[n].user_data;
+		HTTP_RESPONSE* response = &fetches[n].response;
+		if (fetches[n].result != CURLE_OK) continue;
+		if (response->status == 304) {
+			if (!icon_cache) continue;
+			cache_touch(icon_cache, cache->url, icon_expires(response, now));
+			cache->pixbuf = cached_icon_pixbuf(cache->url, cache->mime);
+			/* the body went away from the cache. get it again */
+			if (!cache->pixbuf) refetch[nrefetch++] = cache;
+			continue;
 		}
+		store_icon_response(cache, response, now);
+	}
+	http_fetch_free(fetches, nfetch);
+
+	if (nrefetch > 0) {
+		fetches = malloc(nrefetch*sizeof(HTTP_FETCH));
+		memset(fetches, 0, nrefetch*sizeof(HTTP_FETCH));
+		for(n = 0; n < nrefetch; n++) {
+			fetches[n].url = url_encode_alloc(refetch[n]->url, FALSE);
+			fetches[n].user_data = refetch[n];
+			http_response_init(&fetches[n].response);
+		}
+		http_fetch_all(fetches, nrefetch, icon_fetch_parallel);
+		for(n = 0; n < nrefetch; n++)
+			if (fetches[n].result == CURLE_OK)
+				store_icon_response((PIXBUF_CACHE*)fetches[n].user_data, &fetches[n].response, now);
+		http_fetch_free(fetches, nrefetch);
+	}
+	free(refetch);
+	if (icon_cache) cache_save(icon_cache);
+}
+
+/**
+ * scaled icons
+ *
+ * icons ready to insert, kept for the whole process and keyed by user id and
+ * image url. identical images share one pixbuf. the least recently used
+ * entry is dropped when there are more than ICON_MEMORY_CACHE_SIZE.
+ */
+typedef struct _ICON_IMAGE {
+	char* digest;
+	GdkPixbuf* pixbuf;
+	int refs;
+} ICON_IMAGE;
+
+typedef struct _ICON_ENTRY {
+	char* key;
+	ICON_IMAGE* image;
+	GList* link;		/* node in icon_lru */
+} ICON_ENTRY;
+
+static GHashTable* icon_entries = NULL;	/* key -> ICON_ENTRY */
+static GHashTable* icon_images = NULL;	/* digest -> ICON_IMAGE */
+static GQueue* icon_lru = NULL;		/* most recently used first */
+static GMutex* icon_lock = NULL;
+
+static void icon_image_release(ICON_IMAGE* image) {
+	if (--image->refs > 0) return;
+	g_hash_table_remove(icon_images, image->digest);
+	g_object_unref(image->pixbuf);
+	g_free(image->digest);
+	g_free(image);
+}
+
+static void icon_entry_free(ICON_ENTRY* entry) {
+	icon_image_release(entry->image);
+	g_free(entry->key);
+	g_free(entry);
+}
+
+static void init_icon_memory(void) {
+	icon_entries = g_hash_table_new_full(g_str_hash, g_str_equal, NULL, (GDestroyNotify)icon_entry_free);
+	icon_images = g_hash_table_new(g_str_hash, g_str_equal);
+	icon_lru = g_queue_new();
+	icon_lock = g_mutex_new();
+}
+
+static void term_icon_memory(void) {
+	g_queue_free(icon_lru);
+	g_hash_table_destroy(icon_entries);
+	g_hash_table_destroy(icon_images);
+	g_mutex_free(icon_lock);
+}
+
+static char* icon_key_alloc(const char* user_id, const char* url) {
+	return g_strconcat(user_id ? user_id : "", " ", url, NULL);
+}
+
+/**
+ * content hash of the pixels. the last row has no padding.
+ */
+static char* pixbuf_digest_alloc(GdkPixbuf* pixbuf) {
+	int width = gdk_pixbuf_get_width(pixbuf);
+	int height = gdk_pixbuf_get_height(pixbuf);
+	int channels = gdk_pixbuf_get_n_channels(pixbuf);
+	int rowstride = gdk_pixbuf_get_rowstride(pixbuf);
+	int bits = gdk_pixbuf_get_bits_per_sample(pixbuf);
+	gsize size = rowstride*(height-1) + width*((channels*bits+7)/8);
+	gchar* hash = g_compute_checksum_for_data(G_CHECKSUM_MD5, gdk_pixbuf_get_pixels(pixbuf), size);
+	char* digest = g_strdup_printf("%dx%dx%d:%s", width, height, channels, hash);
+	g_free(hash);
+	return digest;
+}
 
+/**
+ * returns a new reference of the scaled icon, or NULL.
+ */
+static GdkPixbuf* lookup_icon(const char* user_id, const char* url) {
+	ICON_ENTRY* entry;
+	GdkPixbuf* pixbuf = NULL;
+	char* key = icon_key_alloc(user_id, url);
+
+	g_mutex_lock(icon_lock);
+	entry = (ICON_ENTRY*)g_hash_table_lookup(icon_entries, key);
+	if (entry) {
+		g_queue_unlink(icon_lru, entry->link);
+		g_queue_push_head_link(icon_lru, entry->link);
+		pixbuf = g_object_ref(entry->image->pixbuf);
+	}
+	g_mutex_unlock(icon_lock);
+	g_free(key);
+	return pixbuf;
+}
+
+/**
+ * scale the icon once and remember it. returns a new reference of the scaled
+ * icon, or NULL.
+ */
+static GdkPixbuf* store_icon(const char* user_id, const char* url, GdkPixbuf* source) {
+	ICON_ENTRY* entry;
+	ICON_IMAGE* image;
+	GdkPixbuf* scaled;
+	GdkPixbuf* pixbuf;
+	char* digest;
+
+	if (gdk_pixbuf_get_width(source) == ICON_SIZE && gdk_pixbuf_get_height(source) == ICON_SIZE)
+		scaled = g_object_ref(source);
+	else
+		scaled = gdk_pixbuf_scale_simple(source, ICON_SIZE, ICON_SIZE, GDK_INTERP_NEAREST);
+	if (!scaled) return NULL;
+	digest = pixbuf_digest_alloc(scaled);
+
+	g_mutex_lock(icon_lock);
+	image = (ICON_IMAGE*)g_hash_table_lookup(icon_images, digest);
+	if (image) {
+		g_free(digest);
+		g_object_unref(scaled);
+	} else {
+		image = g_new0(ICON_IMAGE, 1);
+		image->digest = digest;
+		image->pixbuf = scaled;
+		g_hash_table_insert(icon_images, image->digest, image);
+	}
+	image->refs++;
+
+	entry = g_new0(ICON_ENTRY, 1);
+	entry->key = icon_key_alloc(user_id, url);
+	entry->image = image;
+	g_queue_push_head(icon_lru, entry);
+	entry->link = g_queue_peek_head_link(icon_lru);
+	{
+		ICON_ENTRY* old = (ICON_ENTRY*)g_hash_table_lookup(icon_entries, entry->key);
+		if (old) g_queue_delete_link(icon_lru, old->link);
+	}
+	g_hash_table_replace(icon_entries, entry->key, entry);
+	pixbuf = g_object_ref(image->pixbuf);
+
+	while(g_queue_get_length(icon_lru) > ICON_MEMORY_CACHE_SIZE) {
+		ICON_ENTRY* last = (ICON_ENTRY*)g_queue_pop_tail(icon_lru);
+		g_hash_table_remove(icon_entries, last->key);
+	}
+	g_mutex_unlock(icon_lock);
+	return pixbuf;
+}
+
+/**
+ * drop statuses over TIMELINE_MAX_STATUSES from the bottom. payloads are
+ * released by the link store.
+ */
+static void trim_statuses(GtkTextBuffer* buffer) {
+	GtkTextIter start, end;
+
+	if (link_store_get_length(link_store) <= TIMELINE_MAX_STATUSES) return;
+	link_store_get_status_iter(link_store, TIMELINE_MAX_STATUSES, &start);
+	gtk_text_buffer_get_end_iter(buffer, &end);
+	gtk_text_buffer_delete(buffer, &start, &end);
+}
+
+/**
+ * validators of timelines are kept per account and url in the timeline
+ * cache. a whole timeline is stored with its body, polls for newer statuses
+ * only with validators.
+ */
+static char* timeline_key_alloc(const char* mail, const char* timeline, gboolean incremental) {
+	return g_strdup_printf("%s %s%s", mail ? mail : "", timeline, incremental ? " since" : "");
+}
+
+static void forget_timeline_validators(const char* mail, const char* timeline) {
+	char* key;
+
+	if (!timeline_cache) return;
+	key = timeline_key_alloc(mail, timeline, FALSE);
+	cache_remove(timeline_cache, key);
+	g_free(key);
+	key = timeline_key_alloc(mail, timeline, TRUE);
+	cache_remove(timeline_cache, key);
+	g_free(key);
+}
+
+static CURLcode request_timeline(const char* url, const char* auth, CACHE_ENTRY* validator, HTTP_RESPONSE* response) {
+	CURL* curl = NULL;
+	CURLcode res = CURLE_OK;
+	struct curl_slist* headers = NULL;
+	gchar* condition = NULL;
+
+	curl = http_engine_acquire(url);
+	curl_easy_setopt(curl, CURLOPT_URL, url);
+	curl_easy_setopt(curl, CURLOPT_USERPWD, auth);
+	if (validator && validator->etag)
+		condition = g_strdup_printf("If-None-Match: %s", validator->etag);
+	else
+	if (validator && validator->last_modified)
+		condition = g_strdup_printf("If-Modified-Since: %s", validator->last_modified);
+	if (condition) {
+		headers = curl_slist_append(headers, condition);
+		curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+	}
+	res = http_perform(curl, response);
+	http_engine_release(curl);
+	if (headers) curl_slist_free_all(headers);
+	if (condition) g_free(condition);
+	return res;
+}
+
+/**
+ * render the statuses from first to before last at the iter.
+ *
+ * [icon] [name:name_tag]
+ * [message]
+ * [date:date_tag]
+ *
+ */
+static void insert_statuses(GtkTextBuffer* buffer, GtkTextIter* iter, LINK_RENDER* render, GPtrArray* statuses, time_t* times, GdkPixbuf** icons, STATUS_SPANS** spans, guint first, guint last) {
+	GtkTextTagTable* table = gtk_text_buffer_get_tag_table(buffer);
+	GtkTextTag* name_tag = gtk_text_tag_table_lookup(table, "name_tag");
+	GtkTextTag* date_tag = gtk_text_tag_table_lookup(table, "date_tag");
+	time_t now = time(NULL);
+	char date[64];
+	guint n;
+	int offset;
+
+	for(n = first; n < last; n++) {
+		STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+		link_render_add_status(render, gtk_text_iter_get_offset(iter));
+		if (icons[n]) gtk_text_buffer_insert_pixbuf(buffer, iter, icons[n]);
+		gtk_text_buffer_insert(buffer, iter, " ", -1);
+		offset = gtk_text_iter_get_offset(iter);
+		gtk_text_buffer_insert_with_tags(buffer, iter, info->name, -1, name_tag, NULL);
+		link_render_add(render, offset, gtk_text_iter_get_offset(iter), NULL, info->id, info->name, info->desc);
+		gtk_text_buffer_insert(buffer, iter, " (", -1);
+		if (info->real) gtk_text_buffer_insert(buffer, iter, info->real, -1);
+		gtk_text_buffer_insert(buffer, iter, ")\n", -1);
+		insert_status_text(buffer, iter, render, spans[n]);
+		gtk_text_buffer_insert(buffer, iter, "\n", -1);
+		format_status_time(info, times[n], now, date, sizeof(date));
+		gtk_text_buffer_insert_with_tags(buffer, iter, date, -1, date_tag, NULL);
+		gtk_text_buffer_insert(buffer, iter, "\n\n", -1);
+	}
+}
+
+/**
+ * statuses go in at the positions given by status_index_insert. ones with
+ * -1 are shown already or were dropped by the index, so they are not
+ * rendered and the buffer keeps one status for each in the index.
+ */
+static void insert_status_runs(GtkTextBuffer* buffer, LINK_STORE* store, GPtrArray* statuses, time_t* times, GdkPixbuf** icons, STATUS_SPANS** spans, int* positions) {
+	LINK_RENDER* render;
+	GtkTextIter iter;
+	guint n, run;
+
+	for(n = 0; n < statuses->len; n = run) {
+		/* statuses going next to each other are rendered at once */
+		for(run = n + 1; run < statuses->len && positions[n] >= 0 && positions[run] == positions[run-1] + 1; run++);
+		if (positions[n] < 0) continue;
+		if (!link_store_split(store, positions[n]) || !link_store_get_status_iter(store, positions[n], &iter))
+			gtk_text_buffer_get_end_iter(buffer, &iter);
+		render = link_store_begin(store, gtk_text_iter_get_offset(&iter));
+		insert_statuses(buffer, &iter, render, statuses, times, icons, spans, n, run);
+		link_store_commit(store, render);
+	}
+}
+
+/**
+ * put the rendered timeline in the view. gdk lock must be held. rows that
+ * went to the list view are taken.
+ */
+static void install_timeline(GtkWidget* window, GPtrArray* statuses, time_t* times, GdkPixbuf** icons, STATUS_SPANS** spans, STATUS_ROW** rows, gboolean incremental) {
+	STATUS_VIEW* view = (STATUS_VIEW*)g_object_get_data(G_OBJECT(window), "statusview");
+	GtkWidget* textview = (GtkWidget*)g_object_get_data(G_OBJECT(window), "textview");
+	GtkTextBuffer* buffer = (GtkTextBuffer*)g_object_get_data(G_OBJECT(window), "buffer");
+	GtkTextMark* top_mark = NULL;
+	GtkTextIter iter;
+	int* positions;
+	guint n;
+
+	/* where each status goes among those shown. ones shown already get -1 */
+	if (!incremental) status_index_clear(status_index);
+	positions = malloc((statuses->len+1)*sizeof(int));
+	for(n = 0; n < statuses->len; n++)
+		positions[n] = status_index_insert(status_index, ((STATUS_INFO*)g_ptr_array_index(statuses, n))->status_id, times[n]);
+	status_index_trim(status_index, view ? TIMELINE_MAX_LIST_STATUSES : TIMELINE_MAX_STATUSES);
+
+	if (view) {
+		/* the view keeps the rows being read in place by itself */
+		if (!incremental) status_view_clear(view);
+		for(n = 0; n < statuses->len; n++) {
+			if (positions[n] < 0) continue;
+			status_view_insert(view, positions[n], rows[n]);
+			rows[n] = NULL;
+		}
+		status_view_trim(view, TIMELINE_MAX_LIST_STATUSES);
+	} else
+	if (incremental) {
+		/* new statuses go in by time, mostly on top. keep the one being read in place */
+		GdkRectangle rect;
+		gtk_text_view_get_visible_rect(GTK_TEXT_VIEW(textview), &rect);
+		if (rect.y > 0) {
+			gtk_text_view_get_iter_at_location(GTK_TEXT_VIEW(textview), &iter, rect.x, rect.y);
+			top_mark = gtk_text_buffer_create_mark(buffer, NULL, &iter, FALSE);
+		}
+		insert_status_runs(buffer, link_store, statuses, times, icons, spans, positions);
+		trim_statuses(buffer);
+		gtk_text_buffer_set_modified(buffer, FALSE);
+		if (top_mark) {
+			gtk_text_view_scroll_to_mark(GTK_TEXT_VIEW(textview), top_mark, 0.0, TRUE, 0.0, 0.0);
+			gtk_text_buffer_delete_mark(buffer, top_mark);
+		}
+	} else {
 		/**
-		 * layout:
-		 *
-		 * [icon] [name:name_tag]
-		 * [message]
-		 * [date:date_tag]
-		 *
+		 * fill a buffer nobody shows and put it in the view at once. the
+		 * tags are shared through the tag table.
 		 */
-		gdk_threads_enter();
-		if (pixbuf) {
-			GdkPixbuf* tmp = gdk_pixbuf_scale_simple(pixbuf, 32, 32, GDK_INTERP_NEAREST);
-			if (tmp) pixbuf = tmp;
-			gtk_text_buffer_insert_pixbuf(buffer, &iter, pixbuf);
+		GtkTextBuffer* fresh = gtk_text_buffer_new(gtk_text_buffer_get_tag_table(buffer));
+		LINK_STORE* store = link_store_new(fresh);
+		insert_status_runs(fresh, store, statuses, times, icons, spans, positions);
+		link_store_free(link_store);
+		link_store = store;
+		trim_statuses(fresh);
+		gtk_text_buffer_get_start_iter(fresh, &iter);
+		gtk_text_buffer_place_cursor(fresh, &iter);
+		gtk_text_view_set_buffer(GTK_TEXT_VIEW(textview), fresh);
+		g_object_set_data(G_OBJECT(window), "buffer", fresh);
+		g_object_unref(fresh);
+	}
+	free(positions);
+}
+
+/**
+ * release what a timeline was rendered from. arrays are as long as statuses.
+ */
+static void free_timeline(GPtrArray* statuses, time_t* times, GdkPixbuf** icons, STATUS_SPANS** spans, STATUS_ROW** rows) {
+	guint n;
+
+	if (!statuses) return;
+	for(n = 0; n < statuses->len; n++) {
+		if (icons && icons[n]) g_object_unref(icons[n]);
+		if (spans) status_spans_free(spans[n]);
+		if (rows && rows[n]) status_row_free(rows[n]);
+		status_info_free((STATUS_INFO*)g_ptr_array_index(statuses, n));
+	}
+	if (times) free(times);
+	if (icons) free(icons);
+	if (spans) free(spans);
+	if (rows) free(rows);
+	g_ptr_array_free(statuses, TRUE);
+}
+
+/**
+ * icons, spans and rows of info->statuses, everything but the buffer. the
+ * lock is not needed.
+ */
+static void prepare_timeline(PREPROCESS_INFO* info) {
+	GPtrArray* statuses = info->statuses;
+	PIXBUF_CACHE* pixbuf_cache = NULL;
+	GdkPixbuf** icons = NULL;
+	STATUS_SPANS** spans = NULL;
+	STATUS_ROW** rows = NULL;
+	int length = statuses->len;
+	int ncache = 0;
+	int n;
+
+	/* icons of users seen before are ready to insert, collect the others */
+	icons = malloc(length*sizeof(GdkPixbuf*));
+	memset(icons, 0, length*sizeof(GdkPixbuf*));
+	pixbuf_cache = malloc(length*sizeof(PIXBUF_CACHE));
+	memset(pixbuf_cache, 0, length*sizeof(PIXBUF_CACHE));
+	for(n = 0; n < length; n++) {
+		STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+		int cache;
+		if (!info->icon) continue;
+		icons[n] = lookup_icon(info->id, info->icon);
+		if (icons[n]) continue;
+
+		/**
+		 * avoid to duplicate downloading of icon.
+		 */
+		for(cache = 0; cache < ncache; cache++)
+			if (!strcmp(pixbuf_cache[cache].url, info->icon)) break;
+		if (cache == ncache)
+			pixbuf_cache[ncache++].url = info->icon;
+	}
+
+	/* load missing icons in parallel before rendering */
+	if (ncache > 0) {
+		fetch_icon_pixbufs(pixbuf_cache, ncache);
+		for(n = 0; n < length; n++) {
+			STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+			int cache;
+			if (!info->icon || icons[n]) continue;
+			icons[n] = lookup_icon(info->id, info->icon);
+			if (icons[n]) continue;
+			for(cache = 0; cache < ncache; cache++) {
+				if (!strcmp(pixbuf_cache[cache].url, info->icon)) {
+					if (pixbuf_cache[cache].pixbuf)
+						icons[n] = store_icon(info->id, info->icon, pixbuf_cache[cache].pixbuf);
+					break;
+				}
+			}
 		}
-		gtk_text_buffer_insert(buffer, &iter, " ", -1);
-		name_tag = gtk_text_buffer_create_tag(
-				buffer,
-				NULL,
-				"scale",
-				PANGO_SCALE_LARGE,
-				"underline",
-				PANGO_UNDERLINE_SINGLE,
-				"weight",
-				PANGO_WEIGHT_BOLD,
-				"foreground",
-				"#0000FF",
-				NULL);
-		g_object_set_data(G_OBJECT(name_tag), "user_id", g_strdup(id));
-		g_object_set_data(G_OBJECT(name_tag), "user_name", g_strdup(name));
-		g_object_set_data(G_OBJECT(name_tag), "user_description", g_strdup(desc));
-		gtk_text_buffer_insert_with_tags(buffer, &iter, name, -1, name_tag, NULL);
-		gtk_text_buffer_insert(buffer, &iter, " (", -1);
-		gtk_text_buffer_insert(buffer, &iter, real, -1);
-		gtk_text_buffer_insert(buffer, &iter, ")\n", -1);
-		text = xml_decode_alloc(text);
-		insert_status_text(buffer, &iter, text);
-		gtk_text_buffer_insert(buffer, &iter, "\n", -1);
-		//dt = strtotime(date);
-		gtk_text_buffer_insert_with_tags(buffer, &iter, date, -1, date_tag, NULL);
-		free(text);
-		gtk_text_buffer_insert(buffer, &iter, "\n\n", -1);
-		gdk_threads_leave();
+	}
+
+	startup_mark("icons loaded");
+
+	for(n = 0; n < ncache; n++) {
+		if (pixbuf_cache[n].pixbuf) g_object_unref(pixbuf_cache[n].pixbuf);
+		g_free(pixbuf_cache[n].mime);
 	}
 	free(pixbuf_cache);
 
+	spans = malloc(length*sizeof(STATUS_SPANS*));
+	memset(spans, 0, length*sizeof(STATUS_SPANS*));
+	if (use_status_view) {
+		rows = malloc(length*sizeof(STATUS_ROW*));
+		memset(rows, 0, length*sizeof(STATUS_ROW*));
+	}
+	info->now = time(NULL);
+	info->icons = icons;
+	info->spans = spans;
+	info->rows = rows;
+	preprocess_statuses(info);
+}
+
+/**
+ * icons, texts and rows of the statuses are made without the lock, then the
+ * timeline is installed at once. statuses and times are taken. title may be
+ * NULL to keep the one shown.
+ */
+static void render_timeline(GtkWidget* window, const char* title, GPtrArray* statuses, time_t* times, gboolean incremental) {
+	PREPROCESS_INFO prepared;
+
+	/* everything but the buffer is made without the lock */
+	memset(&prepared, 0, sizeof(prepared));
+	prepared.statuses = statuses;
+	prepared.times = times;
+	prepare_timeline(&prepared);
+
+	/* install the timeline in one step */
+	gdk_threads_enter();
+	if (title) gtk_window_set_title(GTK_WINDOW(window), title);
+	install_timeline(window, statuses, times, prepared.icons, prepared.spans, prepared.rows, incremental);
+	startup_mark("first timeline");
+	gdk_threads_leave();
+
+	free_timeline(statuses, times, prepared.icons, prepared.spans, prepared.rows);
+}
+
+/**
+ * update friends statuses
+ */
+static gpointer update_friends_statuses_thread(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+	CURLcode res = CURLE_OK;
+	HTTP_RESPONSE response;
+	TIMELINE_SINK sink = { NULL, NULL };
+	CACHE_ENTRY* validator = NULL;
+	char* cache_key = NULL;
+	char* store_key = NULL;
+	gboolean from_cache = FALSE;
+	gchar* user_id = NULL;
+	gchar* user_name = NULL;
+	gchar* status_id = NULL;
+	gchar* title = NULL;
+
+	char url[2048];
+	char timeline[2048];
+	char auth[512];
+	char* recv_data = NULL;
+	char* mail = NULL;
+	char* pass = NULL;
+	int length = 0;
+	gboolean is_thread = FALSE;
+	gboolean incremental = FALSE;
+	gboolean refetch = FALSE;
+	gpointer result_str = NULL;
+
+	STATUS_PARSER* parser = NULL;
+	GPtrArray* statuses = NULL;
+	time_t* times = NULL;
+
+	/* making basic auth info */
+	gdk_threads_enter();
+	mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
+	pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
+	gdk_threads_leave();
+
+	memset(url, 0, sizeof(url));
+	user_id = g_object_get_data(G_OBJECT(window), "user_id");
+	user_name = g_object_get_data(G_OBJECT(window), "user_name");
+	status_id = g_object_get_data(G_OBJECT(window), "status_id");
+	if (status_id) {
+		snprintf(url, sizeof(url)-1, SERVICE_THREAD_STATUS_URL, status_id);
+		is_thread = TRUE;
+		/* status_id is temporary value */
+		g_free(status_id);
+		g_object_set_data(G_OBJECT(window), "status_id", NULL);
+	}
+	else
+	if (user_id)
+		snprintf(url, sizeof(url)-1, SERVICE_USER_STATUS_URL, user_id);
+	else
+		strncpy(url, SERVICE_SELF_STATUS_URL, sizeof(url)-1);
+	strcpy(timeline, url);
+
+	/* timeline being shown only needs statuses newer than it has */
+	if (!is_thread && since_id[0] && !strcmp(timeline_url, timeline)) {
+		size_t len = strlen(url);
+		snprintf(url+len, sizeof(url)-1-len, "?since_id=%s&count=%d", since_id, TIMELINE_POLL_COUNT);
+		incremental = TRUE;
+	}
+	memset(auth, 0, sizeof(auth));
+	snprintf(auth, sizeof(auth)-1, "%s:%s", mail, pass);
+
+	/* validators of the timeline seen before, even by the last run */
+	cache_key = timeline_key_alloc(mail, timeline, incremental);
+	store_key = timeline_key_alloc(mail, timeline, FALSE);
+	if (timeline_cache) validator = cache_lookup(timeline_cache, cache_key);
+	if (validator && !incremental && validator->size == 0) {
+		/* nothing to show for "304 Not Modified" */
+		cache_entry_free(validator);
+		validator = NULL;
+	}
+
+	/* initialize callback data */
+	http_response_init(&response);
+
+	/* statuses are parsed while they are downloaded */
+	statuses = g_ptr_array_new();
+	sink.parser = parser = status_parser_new(append_status, statuses);
+	sink.body = incremental ? NULL : g_string_new(NULL);
+	if (parser) http_response_set_sink(&response, feed_status_parser, &sink);
+
+	/* perform http */
+	res = request_timeline(url, auth, validator, &response);
+	if (response.status == 304 && !incremental && parser) {
+		/* the timeline is as stored */
+		size_t size = 0;
+		char* data = cache_read(timeline_cache, cache_key, &size);
+		if (data) {
+			from_cache = status_parser_feed(parser, data, size);
+			g_free(data);
+			cache_touch(timeline_cache, cache_key, 0);
+		} else {
+			/* the body went away, ask for all again */
+			http_response_clear(&response);
+			http_response_set_sink(&response, feed_status_parser, &sink);
+			res = request_timeline(url, auth, NULL, &response);
+		}
+	}
+
+	if (response.status == 0) {
+		/* offline, read what was stored for the timeline */
+		GPtrArray* stored = incremental ? NULL : status_store_get_timeline(status_store, store_key);
+		if (!stored) {
+			result_str = g_strdup(_("no server response"));
+			goto leave;
+		}
+		free_timeline(statuses, NULL, NULL, NULL, NULL);
+		statuses = stored;
+		goto render;
+	}
+	/* response body is NUL terminated */
+	recv_data = response.data;
+	if (response.status == 304 && !from_cache) {
+		if (timeline_cache) cache_touch(timeline_cache, cache_key, 0);
+		goto leave;
+	}
+	if (!from_cache && response.mime && strcmp(response.mime, "application/xml")) {
+		result_str = g_strdup(_("unknown server response"));
+		goto leave;
+	}
+	if (!from_cache && response.status != 200) {
+		/* failed to get xml */
+		if (recv_data) {
+			entity_decode(recv_data, ENTITY_STRIP_MARKUP);
+			result_str = g_strdup(recv_data);
+		} else
+			result_str = g_strdup(_("unknown server response"));
+		if (response.status == 401) {
+			gdk_threads_enter();
+			if (mail) free(mail);
+			if (pass) free(pass);
+			g_object_set_data(G_OBJECT(window), "mail", NULL);
+			g_object_set_data(G_OBJECT(window), "pass", NULL);
+			gdk_threads_leave();
+			mail = pass = NULL;
+		}
+		goto leave;
+	}
+
+	/* finish parsing xml */
+	if (!parser || res != CURLE_OK || status_parser_finish(parser) < 0) {
+		result_str = g_strdup(_("unknown server response"));
+		goto leave;
+	}
+
+	/* a full page may leave out statuses between it and those shown */
+	if (incremental && statuses->len >= TIMELINE_POLL_COUNT) {
+		since_id[0] = 0;
+		refetch = TRUE;
+		goto leave;
+	}
+
+	/* keep validators for the next request of this timeline */
+	if (timeline_cache && !from_cache) {
+		if (response.etag || response.last_modified)
+			cache_store(timeline_cache, cache_key, 200, response.etag, response.last_modified, response.mime, 0,
+					sink.body ? sink.body->str : NULL, sink.body ? sink.body->len : 0);
+		else
+			cache_remove(timeline_cache, cache_key);
+		cache_save(timeline_cache);
+	}
+
+	/* newest first, whatever order they came in */
+	times = status_times_new(statuses);
+
+	/* for the next run and for reading offline, in the order shown */
+	status_store_update_timeline(status_store, store_key, statuses, !incremental,
+			use_status_view ? TIMELINE_MAX_LIST_STATUSES : TIMELINE_MAX_STATUSES);
+
+render:
+	startup_mark("statuses received");
+	if (user_name)
+		title = g_strdup_printf("%s - %s", APP_TITLE, user_name);
+	else
+	if (user_id)
+		title = g_strdup_printf("%s - (%s)", APP_TITLE, user_id);
+	else
+		title = g_strdup(APP_TITLE);
+
+	if (!times) times = status_times_new(statuses);
+	length = statuses->len;
+
+	/* remember the newest status of this timeline */
+	if (is_thread) {
+		timeline_url[0] = 0;
+		since_id[0] = 0;
+	} else {
+		strncpy(timeline_url, timeline, sizeof(timeline_url)-1);
+		if (length > 0) {
+			STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, 0);
+			if (info->status_id) strncpy(since_id, info->status_id, sizeof(since_id)-1);
+		}
+	}
+
+	render_timeline(window, title, statuses, times, incremental);
+	statuses = NULL;
+	times = NULL;
+
+leave:
+	if (!refetch)
+		schedule_reload(window, &response, result_str != NULL, incremental ? length : -1);
+
+	if (statuses) free_timeline(statuses, times, NULL, NULL, NULL);
+	if (title) g_free(title);
+	if (parser) status_parser_free(parser);
+	if (sink.body) g_string_free(sink.body, TRUE);
+	if (validator) cache_entry_free(validator);
+	if (cache_key) g_free(cache_key);
+	if (store_key) g_free(store_key);
+
+	/* cleanup callback data */
+	http_response_clear(&response);
+
+	/* the whole timeline replaces the one shown */
+	if (refetch) return update_friends_statuses_thread(data);
+	return result_str;
+}
+
+/**
+ * combined timeline
+ */
+static void set_combined_sources(const char* names) {
+	gchar** list = g_strsplit(names, ",", -1);
+	int n;
+
+	for(n = 0; n < combined_count; n++) {
+		g_free(combined_sources[n].name);
+		g_free(combined_sources[n].url);
+	}
+	combined_count = 0;
+	for(n = 0; list[n] && combined_count < COMBINED_MAX_SOURCES; n++) {
+		COMBINED_SOURCE* source = &combined_sources[combined_count];
+		gchar* name = g_strstrip(list[n]);
+		if (!*name) continue;
+		if (!strcmp(name, "friends"))
+			source->url = g_strdup(SERVICE_SELF_STATUS_URL);
+		else
+		if (!strcmp(name, "self"))
+			source->url = g_strdup(SERVICE_MY_STATUS_URL);
+		else
+			source->url = g_strdup_printf(SERVICE_USER_STATUS_URL, name);
+		source->name = g_strdup(name);
+		source->since_id[0] = 0;
+		combined_count++;
+	}
+	g_strfreev(list);
+	if (combined_count == 0) set_combined_sources(COMBINED_DEFAULT_SOURCES);
+}
+
+static char* combined_sources_alloc(void) {
+	GString* names = g_string_new(NULL);
+	int n;
+
+	for(n = 0; n < combined_count; n++) {
+		if (n) g_string_append_c(names, ',');
+		g_string_append(names, combined_sources[n].name);
+	}
+	return g_string_free(names, FALSE);
+}
+
+/**
+ * validators of the polls are kept apart from those of the timeline alone,
+ * which has its own newest status.
+ */
+static char* combined_timeline_alloc(COMBINED_SOURCE* source) {
+	return g_strconcat(COMBINED_TIMELINE_URL, source->url, NULL);
+}
+
+static void forget_combined_validators(const char* mail) {
+	int n;
+
+	for(n = 0; n < combined_count; n++) {
+		char* timeline = combined_timeline_alloc(&combined_sources[n]);
+		forget_timeline_validators(mail, timeline);
+		g_free(timeline);
+	}
+}
+
+typedef struct _COMBINED_FETCH {
+	COMBINED_SOURCE* source;
+	TIMELINE_SINK sink;
+	GPtrArray* statuses;
+	char* cache_key;
+	gboolean incremental;
+	gboolean received;	/* statuses parsed */
+} COMBINED_FETCH;
+
+static gpointer update_combined_statuses_thread(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+	HTTP_FETCH* fetches = NULL;
+	COMBINED_FETCH* combined = NULL;
+	HTTP_RESPONSE* reload = NULL;
+	GPtrArray** timelines = NULL;
+	time_t** times = NULL;
+	GPtrArray* statuses = NULL;
+	time_t* merged_times = NULL;
+	gchar* title = NULL;
+	GString* failed = g_string_new(NULL);
+
+	char auth[512];
+	char* mail = NULL;
+	char* pass = NULL;
+	int n;
+	int length = 0;
+	int ntimeline = 0;
+	int nfailed = 0;
+	gboolean incremental = FALSE;
+	gboolean refetch = FALSE;
+	gpointer result_str = NULL;
+
+	/* making basic auth info */
 	gdk_threads_enter();
-	gtk_text_buffer_set_modified(buffer, FALSE) ;
-	gtk_text_buffer_get_start_iter(buffer, &iter);
-	gtk_text_buffer_place_cursor(buffer, &iter);
+	mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
+	pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
 	gdk_threads_leave();
 
+	memset(auth, 0, sizeof(auth));
+	snprintf(auth, sizeof(auth)-1, "%s:%s", mail, pass);
+
+	/* the combined timeline being shown only needs what is new */
+	incremental = !strcmp(timeline_url, COMBINED_TIMELINE_URL);
+
+	fetches = malloc(combined_count*sizeof(HTTP_FETCH));
+	memset(fetches, 0, combined_count*sizeof(HTTP_FETCH));
+	combined = malloc(combined_count*sizeof(COMBINED_FETCH));
+	memset(combined, 0, combined_count*sizeof(COMBINED_FETCH));
+	for(n = 0; n < combined_count; n++) {
+		COMBINED_SOURCE* source = &combined_sources[n];
+		COMBINED_FETCH* fetch = &combined[n];
+		CACHE_ENTRY* validator = NULL;
+		char* timeline = combined_timeline_alloc(source);
+		char header[512];
+
+		if (!incremental) source->since_id[0] = 0;
+		fetch->source = source;
+		fetch->incremental = source->since_id[0] != 0;
+		fetches[n].url = malloc(strlen(source->url) + strlen(source->since_id) + 32);
+		if (fetch->incremental)
+			sprintf(fetches[n].url, "%s?since_id=%s&count=%d", source->url, source->since_id, TIMELINE_POLL_COUNT);
+		else
+			strcpy(fetches[n].url, source->url);
+		fetches[n].userpwd = auth;
+		fetches[n].user_data = fetch;
+
+		/* polls are asked whether anything came */
+		fetch->cache_key = timeline_key_alloc(mail, timeline, TRUE);
+		g_free(timeline);
+		if (timeline_cache && fetch->incremental) validator = cache_lookup(timeline_cache, fetch->cache_key);
+		if (validator && validator->etag) {
+			snprintf(header, sizeof(header), "If-None-Match: %s", validator->etag);
+			fetches[n].headers = curl_slist_append(fetches[n].headers, header);
+		} else
+		if (validator && validator->last_modified) {
+			snprintf(header, sizeof(header), "If-Modified-Since: %s", validator->last_modified);
+			fetches[n].headers = curl_slist_append(fetches[n].headers, header);
+		}
+		if (validator) cache_entry_free(validator);
+
+		/* statuses are parsed while they are downloaded */
+		fetch->statuses = g_ptr_array_new();
+		fetch->sink.parser = status_parser_new(append_status, fetch->statuses);
+		http_response_init(&fetches[n].response);
+		if (fetch->sink.parser) http_response_set_sink(&fetches[n].response, feed_status_parser, &fetch->sink);
+	}
+
+	/* all timelines in one pass */
+	http_fetch_all(fetches, combined_count, combined_count);
+
+	/* every answer is looked at before since_id, validators or the store change */
+	for(n = 0; n < combined_count; n++) {
+		COMBINED_FETCH* fetch = &combined[n];
+		HTTP_RESPONSE* response = &fetches[n].response;
+
+		/* the poll follows the tightest rate limit */
+		if (!reload || (response->rate_remaining >= 0
+				&& (reload->rate_remaining < 0 || response->rate_remaining < reload->rate_remaining)))
+			reload = response;
+		if (response->status == 401) {
+			entity_decode(response->data, ENTITY_STRIP_MARKUP);
+			result_str = g_strdup(response->data ? response->data : _("unknown server response"));
+			gdk_threads_enter();
+			if (mail) free(mail);
+			if (pass) free(pass);
+			g_object_set_data(G_OBJECT(window), "mail", NULL);
+			g_object_set_data(G_OBJECT(window), "pass", NULL);
+			gdk_threads_leave();
+			mail = pass = NULL;
+			/* the others were asked with the same account */
+			goto leave;
+		}
+		if (fetches[n].result == CURLE_OK && response->status == 200 && fetch->sink.parser
+				&& status_parser_finish(fetch->sink.parser) >= 0)
+			fetch->received = TRUE;
+		/* a full page may leave out statuses between it and those shown */
+		if (fetch->received && fetch->incremental && fetch->statuses->len >= TIMELINE_POLL_COUNT)
+			refetch = TRUE;
+	}
+	if (refetch) {
+		/* not incremental, every source starts over */
+		timeline_url[0] = 0;
+		goto leave;
+	}
+
+	timelines = malloc(combined_count*sizeof(GPtrArray*));
+	times = malloc(combined_count*sizeof(time_t*));
+	for(n = 0; n < combined_count; n++) {
+		COMBINED_FETCH* fetch = &combined[n];
+		HTTP_RESPONSE* response = &fetches[n].response;
+		char* store_key;
+
+		if (response->status == 304) continue;
+		if (!fetch->received) {
+			if (failed->len) g_string_append(failed, ", ");
+			g_string_append(failed, fetch->source->name);
+			nfailed++;
+			continue;
+		}
+
+		/* keep validators for the next poll */
+		if (timeline_cache) {
+			if (response->etag || response->last_modified)
+				cache_store(timeline_cache, fetch->cache_key, 200, response->etag, response->last_modified, response->mime, 0, NULL, 0);
+			else
+				cache_remove(timeline_cache, fetch->cache_key);
+		}
+
+		/* for the next run and for reading offline, in the order shown */
+		times[ntimeline] = status_times_new(fetch->statuses);
+		store_key = timeline_key_alloc(mail, fetch->source->url, FALSE);
+		status_store_update_timeline(status_store, store_key, fetch->statuses, !fetch->incremental,
+				use_status_view ? TIMELINE_MAX_LIST_STATUSES : TIMELINE_MAX_STATUSES);
+		g_free(store_key);
+
+		if (fetch->statuses->len > 0) {
+			STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(fetch->statuses, 0);
+			if (info->status_id) strncpy(fetch->source->since_id, info->status_id, sizeof(fetch->source->since_id)-1);
+		}
+		timelines[ntimeline++] = fetch->statuses;
+	}
+	if (timeline_cache) cache_save(timeline_cache);
+	if (nfailed == combined_count) {
+		result_str = g_strdup(_("no server response"));
+		goto leave;
+	}
+
+	/* k-way merge of the timelines, each of them in order */
+	statuses = status_time_merge(timelines, times, ntimeline, &merged_times);
+	length = statuses->len;
+	title = g_strdup_printf("%s - %s", APP_TITLE, _("combined"));
+	strncpy(timeline_url, COMBINED_TIMELINE_URL, sizeof(timeline_url)-1);
+	since_id[0] = 0;
+
+	render_timeline(window, title, statuses, merged_times, incremental);
+
+	/* the others are shown, those failed are asked again by the next poll */
+	if (nfailed > 0)
+		result_str = g_strdup_printf(_("could not fetch the timeline of %s"), failed->str);
+
 leave:
-	if (recv_data) free(recv_data);
-	if (path) xmlXPathFreeObject(path);
-	if (ctx) xmlXPathFreeContext(ctx);
-	if (doc) xmlFreeDoc(doc);
+	if (!refetch)
+		schedule_reload(window, reload, result_str != NULL, incremental ? length : -1);
+
+	for(n = 0; n < ntimeline; n++)
+		free(times[n]);
+	for(n = 0; n < combined_count; n++) {
+		if (combined[n].sink.parser) status_parser_free(combined[n].sink.parser);
+		free_timeline(combined[n].statuses, NULL, NULL, NULL, NULL);
+		g_free(combined[n].cache_key);
+	}
+	free(combined);
+	free(timelines);
+	free(times);
+	if (title) g_free(title);
+	g_string_free(failed, TRUE);
 
 	/* cleanup callback data */
-	terminate_http_response();
+	http_fetch_free(fetches, combined_count);
 
+	/* the whole timelines replace the one shown */
+	if (refetch) return update_combined_statuses_thread(data);
 	return result_str;
 }
 
+/**
+ * a thread or a user asked for goes before the combined timeline.
+ */
+static gpointer refresh_statuses_thread(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+
+	if (g_object_get_data(G_OBJECT(window), "combined") && !g_object_get_data(G_OBJECT(window), "status_id"))
+		return update_combined_statuses_thread(data);
+	return update_friends_statuses_thread(data);
+}
+
+/**
+ * connections to the api and icon hosts are opened in the background while
+ * the window is built.
+ */
+static GSList* preconnect_threads = NULL;
+
+static char* url_root_alloc(const char* url) {
+	const char* ptr = strstr(url, "://");
+	if (!ptr) return NULL;
+	ptr = strchr(ptr + 3, '/');
+	return ptr ? g_strndup(url, ptr - url + 1) : g_strconcat(url, "/", NULL);
+}
+
+static gpointer preconnect_thread(gpointer data) {
+	gchar** urls = (gchar**)data;
+	int n;
+	for(n = 0; urls[n]; n++)
+		http_engine_preconnect(urls[n]);
+	g_strfreev(urls);
+	return NULL;
+}
+
+static void start_preconnect(gchar** urls) {
+	GThread* thread = NULL;
+
+	if (urls && urls[0])
+		thread = g_thread_create(preconnect_thread, urls, TRUE, NULL);
+	if (thread)
+		preconnect_threads = g_slist_prepend(preconnect_threads, thread);
+	else
+		g_strfreev(urls);
+}
+
+static void join_preconnect(void) {
+	while(preconnect_threads) {
+		g_thread_join((GThread*)preconnect_threads->data);
+		preconnect_threads = g_slist_delete_link(preconnect_threads, preconnect_threads);
+	}
+}
+
+/**
+ * icon of the last run, without the network.
+ */
+static GdkPixbuf* stored_icon(STATUS_INFO* info) {
+	CACHE_ENTRY* entry = NULL;
+	GdkPixbuf* pixbuf = NULL;
+	GdkPixbuf* icon = NULL;
+
+	if (!info->icon) return NULL;
+	icon = lookup_icon(info->id, info->icon);
+	if (icon || !icon_cache) return icon;
+	entry = cache_lookup(icon_cache, info->icon);
+	if (entry && entry->status == 200)
+		pixbuf = cached_icon_pixbuf(info->icon, entry->mime);
+	cache_entry_free(entry);
+	if (!pixbuf) return NULL;
+	icon = store_icon(info->id, info->icon, pixbuf);
+	g_object_unref(pixbuf);
+	return icon;
+}
+
+/**
+ * show the friends timeline of the last run from the status store, so the
+ * window is not empty while it is refreshed. runs in a thread of
+ * process_func once the window was painted, and before the first refresh,
+ * which asks only for what came after.
+ */
+static gpointer show_stored_timeline_thread(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+	GPtrArray* statuses = NULL;
+	char* mail = NULL;
+	char* key = NULL;
+	time_t* times = NULL;
+	GdkPixbuf** icons = NULL;
+	STATUS_SPANS** spans = NULL;
+	STATUS_ROW** rows = NULL;
+	PREPROCESS_INFO preprocess;
+	GPtrArray* hosts = NULL;
+	STATUS_INFO* info;
+	guint n;
+
+	gdk_threads_enter();
+	mail = g_strdup((char*)g_object_get_data(G_OBJECT(window), "mail"));
+	gdk_threads_leave();
+	key = timeline_key_alloc(mail, SERVICE_SELF_STATUS_URL, FALSE);
+	statuses = status_store_get_timeline(status_store, key);
+	g_free(key);
+	g_free(mail);
+	if (!statuses) return NULL;
+	times = status_times_new(statuses);
+	icons = malloc(statuses->len*sizeof(GdkPixbuf*));
+	for(n = 0; n < statuses->len; n++)
+		icons[n] = stored_icon((STATUS_INFO*)g_ptr_array_index(statuses, n));
+
+	/* icons will be asked again from the same hosts */
+	hosts = g_ptr_array_new();
+	for(n = 0; n < statuses->len && hosts->len < PRECONNECT_ICON_HOSTS; n++) {
+		char* root;
+		guint found;
+		info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+		root = info->icon ? url_root_alloc(info->icon) : NULL;
+		if (!root) continue;
+		for(found = 0; found < hosts->len; found++)
+			if (!strcmp(root, (char*)g_ptr_array_index(hosts, found))) break;
+		if (found == hosts->len)
+			g_ptr_array_add(hosts, root);
+		else
+			g_free(root);
+	}
+	g_ptr_array_add(hosts, NULL);
+	start_preconnect((gchar**)g_ptr_array_free(hosts, FALSE));
+	spans = malloc(statuses->len*sizeof(STATUS_SPANS*));
+	memset(spans, 0, statuses->len*sizeof(STATUS_SPANS*));
+	if (use_status_view) {
+		rows = malloc(statuses->len*sizeof(STATUS_ROW*));
+		memset(rows, 0, statuses->len*sizeof(STATUS_ROW*));
+	}
+	preprocess.statuses = statuses;
+	preprocess.times = times;
+	preprocess.now = time(NULL);
+	preprocess.icons = icons;
+	preprocess.spans = spans;
+	preprocess.rows = rows;
+	preprocess_statuses(&preprocess);
+	gdk_threads_enter();
+	install_timeline(window, statuses, times, icons, spans, rows, FALSE);
+	startup_mark("stored timeline");
+	gdk_threads_leave();
+
+	/* the refresh only asks for what came after */
+	info = (STATUS_INFO*)g_ptr_array_index(statuses, 0);
+	strncpy(timeline_url, SERVICE_SELF_STATUS_URL, sizeof(timeline_url)-1);
+	if (info->status_id) strncpy(since_id, info->status_id, sizeof(since_id)-1);
+	free_timeline(statuses, times, icons, spans, rows);
+	return NULL;
+}
+
+/**
+ * watch cursor on the timeline while processing.
+ */
+static void set_view_busy(GtkWidget* window, gboolean busy) {
+	GtkWidget* textview = (GtkWidget*)g_object_get_data(G_OBJECT(window), "textview");
+	STATUS_VIEW* view = (STATUS_VIEW*)g_object_get_data(G_OBJECT(window), "statusview");
+
+	if (view) status_view_set_busy(view, busy);
+	if (textview)
+		gdk_window_set_cursor(
+				gtk_text_view_get_window(
+					GTK_TEXT_VIEW(textview),
+					GTK_TEXT_WINDOW_TEXT),
+				busy ? watch_cursor : regular_cursor);
+}
+
 static void update_friends_statuses(GtkWidget* widget, gpointer user_data) {
 	gpointer result;
 	GtkWidget* window = (GtkWidget*)user_data;
-	GtkWidget* textview = (GtkWidget*)g_object_get_data(G_OBJECT(window), "textview");
 	GtkWidget* toolbox = (GtkWidget*)g_object_get_data(G_OBJECT(window), "toolbox");
 	char* mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
 	char* pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
 
+	/* the one running writes since_id, timeline_url and the view */
+	if (is_processing) return;
+
 	if (!mail || !pass) {
 		if (!login_dialog(window)) return;
 	}
@@ -926,13 +2028,10 @@ static void update_friends_statuses(GtkWidget* widget, gpointer user_data) {
 	stop_reload_timer(window);
 	/* disable toolbox */
 	gtk_widget_set_sensitive(toolbox, FALSE);
-	/* set watch cursor at textview */
-	gdk_window_set_cursor(
-			gtk_text_view_get_window(
-				GTK_TEXT_VIEW(textview),
-				GTK_TEXT_WINDOW_TEXT),
-			watch_cursor);
-	result = process_func(update_friends_statuses_thread, window, window, _("updating statuses..."));
+	/* set watch cursor at timeline */
+	set_view_busy(window, TRUE);
+	result = process_func(refresh_statuses_thread, window, window, _("updating statuses..."));
+	startup_report();
 	if (result) {
 		/* show error message */
 		error_dialog(window, result);
@@ -940,12 +2039,8 @@ static void update_friends_statuses(GtkWidget* widget, gpointer user_data) {
 	}
 	/* enable toolbox */
 	gtk_widget_set_sensitive(toolbox, TRUE);
-	/* set regular cursor at textview */
-	gdk_window_set_cursor(
-			gtk_text_view_get_window(
-				GTK_TEXT_VIEW(textview),
-				GTK_TEXT_WINDOW_TEXT),
-			regular_cursor);
+	/* set regular cursor at timeline */
+	set_view_busy(window, FALSE);
 	start_reload_timer(window);
 
 	is_processing = FALSE;
@@ -956,6 +2051,26 @@ static void update_self_status(GtkWidget* widget, gpointer user_data) {
 	GtkWidget* toolbox = (GtkWidget*)g_object_get_data(G_OBJECT(window), "toolbox");
 	gchar* old_data;
 
+	if (is_processing) return;
+
+	old_data = g_object_get_data(G_OBJECT(window), "user_id");
+	if (old_data) g_free(old_data);
+	old_data = g_object_get_data(G_OBJECT(window), "user_name");
+	if (old_data) g_free(old_data);
+
+	g_object_set_data(G_OBJECT(window), "user_id", NULL);
+	g_object_set_data(G_OBJECT(window), "user_name", NULL);
+	g_object_set_data(G_OBJECT(window), "combined", NULL);
+
+	update_friends_statuses(NULL, window);
+}
+
+static void update_combined_statuses(GtkWidget* widget, gpointer user_data) {
+	GtkWidget* window = (GtkWidget*)user_data;
+	gchar* old_data;
+
+	if (is_processing) return;
+
 	old_data = g_object_get_data(G_OBJECT(window), "user_id");
 	if (old_data) g_free(old_data);
 	old_data = g_object_get_data(G_OBJECT(window), "user_name");
@@ -963,20 +2078,77 @@ static void update_self_status(GtkWidget* widget, gpointer user_data) {
 
 	g_object_set_data(G_OBJECT(window), "user_id", NULL);
 	g_object_set_data(G_OBJECT(window), "user_name", NULL);
+	g_object_set_data(G_OBJECT(window), "combined", GINT_TO_POINTER(TRUE));
 
 	update_friends_statuses(NULL, window);
 }
 
+/**
+ * the status answered to an update. returns NULL when it could not be read.
+ */
+static GPtrArray* parse_posted_status(HTTP_RESPONSE* response) {
+	GPtrArray* statuses = g_ptr_array_new();
+	STATUS_PARSER* parser = status_parser_new(append_status, statuses);
+
+	if (!parser || !response->data
+			|| !status_parser_feed(parser, response->data, response->size)
+			|| status_parser_finish(parser) != 1) {
+		if (parser) status_parser_free(parser);
+		free_timeline(statuses, NULL, NULL, NULL, NULL);
+		return NULL;
+	}
+	status_parser_free(parser);
+	return statuses;
+}
+
+/**
+ * the posted status goes on top of the timeline shown when it belongs
+ * there, without fetching the timeline again. the next refresh finds it in
+ * status_index and leaves it as it is. runs in main loop with the lock
+ * held while no refresh is running, so status_index, the view and
+ * timeline_url are changed by one thread at a time.
+ */
+static void insert_posted_status(GtkWidget* window, PREPROCESS_INFO* prepared) {
+	STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(prepared->statuses, 0);
+	gboolean shown = FALSE;
+	char url[2048];
+
+	if (!strcmp(timeline_url, SERVICE_SELF_STATUS_URL)
+			|| !strcmp(timeline_url, SERVICE_MY_STATUS_URL)
+			|| !strcmp(timeline_url, COMBINED_TIMELINE_URL))
+		shown = TRUE;
+	else
+	if (info->id && info->name) {
+		snprintf(url, sizeof(url)-1, SERVICE_USER_STATUS_URL, info->name);
+		shown = !strcmp(timeline_url, url);
+		snprintf(url, sizeof(url)-1, SERVICE_USER_STATUS_URL, info->id);
+		shown = shown || !strcmp(timeline_url, url);
+	}
+
+	if (shown)
+		install_timeline(window, prepared->statuses, prepared->times, prepared->icons, prepared->spans, prepared->rows, TRUE);
+	free_timeline(prepared->statuses, prepared->times, prepared->icons, prepared->spans, prepared->rows);
+	g_free(prepared);
+}
+
 /**
  * post my status
+ *
+ * posts go to the outbox and the entry is cleared at once. the sender of
+ * the outbox calls post_outbox_item in its own thread. the status answered
+ * is made ready to insert there and handed to main loop through
+ * posted_statuses.
  */
-static gpointer post_status_thread(gpointer data) {
-	GtkWidget* window = (GtkWidget*)data;
-	GtkWidget* entry = NULL;
+
+static OUTBOX_RESULT post_outbox_item(OUTBOX_ITEM* item, char** error, long* retry_after, gpointer user_data) {
+	GtkWidget* window = (GtkWidget*)user_data;
 	CURL* curl = NULL;
 	CURLcode res = CURLE_OK;
 	struct curl_slist *headers = NULL;
-	long status = 0;
+	HTTP_RESPONSE response;
+	OUTBOX_RESULT result = OUTBOX_SENT;
+	PREPROCESS_INFO* prepared;
+	GPtrArray* statuses;
 
 	char url[2048];
 	char auth[512];
@@ -984,23 +2156,24 @@ static gpointer post_status_thread(gpointer data) {
 	char* sanitized_message = NULL;
 	char* mail = NULL;
 	char* pass = NULL;
-	gpointer result_str = NULL;
 
 	gdk_threads_enter();
-	mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
-	pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
-	entry = (GtkWidget*)g_object_get_data(G_OBJECT(window), "entry");
-	message = (char*)gtk_entry_get_text(GTK_ENTRY(entry));
+	mail = g_strdup((char*)g_object_get_data(G_OBJECT(window), "mail"));
+	pass = g_strdup((char*)g_object_get_data(G_OBJECT(window), "pass"));
 	gdk_threads_leave();
-	if (!message || strlen(message) == 0) return NULL;
+	if (!mail || !pass || strcmp(mail, item->account)) {
+		/* wait until the account is back */
+		*error = g_strdup_printf(_("not logged in as %s"), item->account);
+		result = OUTBOX_RETRY;
+		goto leave;
+	}
 
 	/* making authenticate info */
 	memset(url, 0, sizeof(url));
 	strncpy(url, SERVICE_UPDATE_URL, sizeof(url)-1);
-	sanitized_message = sanitize_message_alloc(message);
-	if (!message) return NULL;
-	message = sanitized_message;
-	message = url_encode_alloc(message, TRUE);
+	sanitized_message = sanitize_message_alloc(item->message);
+	if (!sanitized_message) goto leave;
+	message = url_encode_alloc(sanitized_message, TRUE);
 	free(sanitized_message);
 	if (message) {
 		strncat(url, "?status=", sizeof(url)-1);;
@@ -1012,102 +2185,176 @@ static gpointer post_status_thread(gpointer data) {
 	snprintf(auth, sizeof(auth)-1, "%s:%s", mail, pass);
 
 	/* initialize callback data */
-	initialize_http_response();
+	http_response_init(&response);
 
 	headers = curl_slist_append(headers, "X-Twitter-Client: "APP_NAME);
 	headers = curl_slist_append(headers, "X-Twitter-Client-Version: "APP_VERSION);
 	headers = curl_slist_append(headers, "X-Twitter-Client-URL: "APP_URL);
 
 	/* perform http */
-	curl = curl_easy_init();
+	curl = http_engine_acquire(url);
 	curl_easy_setopt(curl, CURLOPT_URL, url);
 	curl_easy_setopt(curl, CURLOPT_USERPWD, auth);
-	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, handle_returned_data);
-	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, handle_returned_header);
-	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
 	curl_easy_setopt(curl, CURLOPT_POSTFIELDS, "");
 	curl_easy_setopt(curl, CURLOPT_POST, 1);
-	curl_easy_setopt(curl, CURLOPT_USERAGENT, APP_NAME);
 	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-	res = curl_easy_perform(curl);
-	res == CURLE_OK ? curl_easy_getinfo(curl, CURLINFO_HTTP_CODE, &status) : res;
-	curl_easy_cleanup(curl);
+	res = http_perform(curl, &response);
+	http_engine_release(curl);
 	if (headers) curl_slist_free_all(headers);
 
-	if (status != 200) {
+	if (res == CURLE_OK && response.status == 200) {
+		/* shown at once. the timeline is fetched only when it can't be */
+		statuses = parse_posted_status(&response);
+		if (statuses) {
+			prepared = g_new0(PREPROCESS_INFO, 1);
+			prepared->statuses = statuses;
+			prepared->times = status_times_new(statuses);
+			prepare_timeline(prepared);
+			g_async_queue_push(posted_statuses, prepared);
+		} else
+			g_atomic_int_set(&post_refresh_pending, 1);
+	} else
+	if (res != CURLE_OK) {
+		/* network is down. try again later */
+		*error = g_strdup(curl_easy_strerror(res));
+		result = OUTBOX_RETRY;
+	} else
+	if (response.status != 200) {
 		/* failed to the post */
-		if (response_data) {
-			char* message;
-			char* recv_data = malloc(response_size+1);
-			memset(recv_data, 0, response_size+1);
-			memcpy(recv_data, response_data, response_size);
-			message = xml_decode_alloc(recv_data);
-			result_str = g_strdup(message);
-			free(message);
+		if (response.data) {
+			entity_decode(response.data, ENTITY_STRIP_MARKUP);
+			*error = g_strdup(response.data);
 		} else
-			result_str = g_strdup(_("unknown server response"));
-		goto leave;
-	} else {
-		/* succeeded to the post */
-		gdk_threads_enter();
-		gtk_entry_set_text(GTK_ENTRY(entry), "");
-		gdk_threads_leave();
+			*error = g_strdup(_("unknown server response"));
+		if (response.status == 401) {
+			/* wrong password. the post waits for the next login */
+			char* current_mail;
+			char* current_pass;
+			gdk_threads_enter();
+			current_mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
+			current_pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
+			if (current_mail && current_pass && !strcmp(current_mail, mail) && !strcmp(current_pass, pass)) {
+				free(current_mail);
+				free(current_pass);
+				g_object_set_data(G_OBJECT(window), "mail", NULL);
+				g_object_set_data(G_OBJECT(window), "pass", NULL);
+			}
+			gdk_threads_leave();
+			result = OUTBOX_RETRY;
+		} else
+		/* server errors and rate limit may pass */
+		if (response.status == 0 || response.status >= 500
+				|| response.status == 420 || response.status == 429) {
+			*retry_after = response.retry_after;
+			result = OUTBOX_RETRY;
+		} else
+			result = OUTBOX_REJECTED;
+	}
+
+	/* cleanup callback data */
+	http_response_clear(&response);
+
+leave:
+	g_free(mail);
+	g_free(pass);
+	return result;
+}
+
+static void update_outbox_label(GtkWidget* window) {
+	GtkWidget* outbox_label = (GtkWidget*)g_object_get_data(G_OBJECT(window), "outbox-label");
+	OUTBOX_STATUS status;
+	gchar* text;
+
+	if (!outbox || !outbox_label) return;
+	outbox_get_status(outbox, &status);
+	if (status.length == 0) {
+		gtk_widget_hide(outbox_label);
+		return;
+	}
+	if (status.sending)
+		text = g_strdup_printf(_("posting... (%d in outbox)"), status.length);
+	else
+	if (status.error)
+		text = g_strdup_printf(_("%d in outbox: %s"), status.length, status.error);
+	else
+		text = g_strdup_printf(_("%d in outbox"), status.length);
+	gtk_label_set_text(GTK_LABEL(outbox_label), text);
+	gtk_widget_show(outbox_label);
+	g_free(text);
+	outbox_status_clear(&status);
+}
+
+/**
+ * runs in main loop after the outbox was changed. posted statuses are put
+ * in the view and posts refused by the server are shown. when a posted status could not be put in the view, the
+ * timeline is refreshed once every post sent so far is out, not once for
+ * each of them.
+ */
+static gboolean outbox_changed(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+	GtkWidget* entry;
+	OUTBOX_ITEM* item;
+	OUTBOX_STATUS status;
+	PREPROCESS_INFO* prepared;
+	gboolean drained;
+
+	/* process_func holds the lock while it runs the loop. ask again later */
+	if (is_processing) return TRUE;
+
+	g_atomic_int_set(&outbox_notify_pending, 0);
+	gdk_threads_enter();
+	update_outbox_label(window);
+	while((prepared = (PREPROCESS_INFO*)g_async_queue_try_pop(posted_statuses)))
+		insert_posted_status(window, prepared);
+	entry = (GtkWidget*)g_object_get_data(G_OBJECT(window), "entry");
+	while((item = outbox_take_rejected(outbox))) {
+		/* message is given back to be fixed */
+		if (!*gtk_entry_get_text(GTK_ENTRY(entry)))
+			gtk_entry_set_text(GTK_ENTRY(entry), item->message);
+		error_dialog(window, item->error ? item->error : _("unknown server response"));
+		outbox_item_free(item);
 	}
 
-leave:
-	/* cleanup callback data */
-	if (response_cond) free(response_cond);
-	if (response_mime) free(response_mime);
-	if (response_data) free(response_data);
-	response_data = NULL;
-	response_mime = NULL;
-	response_cond = NULL;
-	response_size = 0;
-	return result_str;
+	outbox_get_status(outbox, &status);
+	drained = status.length == 0 || (!status.sending && status.next_try > time(NULL));
+	outbox_status_clear(&status);
+	if (drained && g_atomic_int_compare_and_exchange(&post_refresh_pending, 1, 0)) {
+		/* own status is not in what was validated before */
+		forget_timeline_validators((char*)g_object_get_data(G_OBJECT(window), "mail"), timeline_url);
+		forget_combined_validators((char*)g_object_get_data(G_OBJECT(window), "mail"));
+		update_friends_statuses(NULL, window);
+	}
+	gdk_threads_leave();
+	return FALSE;
+}
+
+static void on_outbox_notify(OUTBOX* outbox, gpointer user_data) {
+	/* one pending call is enough for any number of changes */
+	if (g_atomic_int_compare_and_exchange(&outbox_notify_pending, 0, 1))
+		g_timeout_add(OUTBOX_NOTIFY_SPAN, outbox_changed, user_data);
 }
 
 static void post_status(GtkWidget* widget, gpointer user_data) {
-	gpointer result;
 	GtkWidget* window = (GtkWidget*)user_data;
-	GtkWidget* textview = (GtkWidget*)g_object_get_data(G_OBJECT(window), "textview");
-	GtkWidget* toolbox = (GtkWidget*)g_object_get_data(G_OBJECT(window), "toolbox");
+	GtkWidget* entry = (GtkWidget*)g_object_get_data(G_OBJECT(window), "entry");
 	char* mail = (char*)g_object_get_data(G_OBJECT(window), "mail");
 	char* pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
+	const char* message = gtk_entry_get_text(GTK_ENTRY(entry));
 
-	if (!mail || !pass) {
-		if (!login_dialog(window)) return;
+	if (!message || strlen(message) == 0) return;
+	if (!outbox) {
+		error_dialog(window, _("can't open outbox"));
+		return;
 	}
 
-	is_processing = TRUE;
-
-	/* disable toolbox */
-	gtk_widget_set_sensitive(toolbox, FALSE);
-	/* set watch cursor at textview */
-	gdk_window_set_cursor(
-			gtk_text_view_get_window(
-				GTK_TEXT_VIEW(textview),
-				GTK_TEXT_WINDOW_TEXT),
-			watch_cursor);
-	result = process_func(post_status_thread, window, window, _("posting status..."));
-	if (!result) {
-		last_condition[0] = 0;
-		result = process_func(update_friends_statuses_thread, window, window, _("updating statuses..."));
-	}
-	if (result) {
-		/* show error message */
-		error_dialog(window, result);
-		g_free(result);
+	if (!mail || !pass) {
+		if (!login_dialog(window)) return;
+		outbox_kick(outbox);
 	}
-	/* enable toolbox */
-	gtk_widget_set_sensitive(toolbox, TRUE);
-	/* set regular cursor at textview */
-	gdk_window_set_cursor(
-			gtk_text_view_get_window(
-				GTK_TEXT_VIEW(textview),
-				GTK_TEXT_WINDOW_TEXT),
-			regular_cursor);
 
-	is_processing = FALSE;
+	outbox_push(outbox, (char*)g_object_get_data(G_OBJECT(window), "mail"), message);
+	gtk_entry_set_text(GTK_ENTRY(entry), "");
+	update_outbox_label(window);
 }
 
 /**
@@ -1120,8 +2367,9 @@ static gboolean on_entry_activate(GtkWidget *widget, gpointer user_data) {
 
 	if (!message || strlen(message) == 0) return FALSE;
 
+	/* what was typed last is shortened by the post itself */
+	stop_shorten_timer();
 	post_status(widget, user_data);
-	reset_reload_timer(gtk_widget_get_toplevel(widget));
 	return FALSE;
 }
 
@@ -1215,13 +2463,11 @@ static gboolean login_dialog(GtkWidget* window) {
 
 static void textview_change_cursor(GtkWidget* textview, gint x, gint y) {
 	static gboolean hovering_over_link = FALSE;
-	GSList *tags = NULL;
 	GtkWidget* toplevel;
 	GtkTextBuffer *buffer;
 	GtkTextIter iter;
 	GtkTooltips* tooltips = NULL;
 	gboolean hovering = FALSE;
-	int len, n;
 
 	if (is_processing) {
 		return;
@@ -1232,27 +2478,7 @@ static void textview_change_cursor(GtkWidget* textview, gint x, gint y) {
 	gtk_text_view_get_iter_at_location(GTK_TEXT_VIEW(textview), &iter, x, y);
 	tooltips = (GtkTooltips*)g_object_get_data(G_OBJECT(toplevel), "tooltips");
 
-	tags = gtk_text_iter_get_tags(&iter);
-	if (tags) {
-		len = g_slist_length(tags);
-		for(n = 0; n < len; n++) {
-			GtkTextTag* tag = (GtkTextTag*)g_slist_nth_data(tags, n);
-			if (tag) {
-				gpointer url;
-				url = g_object_get_data(G_OBJECT(tag), "url");
-				if (url) {
-					hovering = TRUE;
-					break;
-				}
-				url = g_object_get_data(G_OBJECT(tag), "user_id");
-				if (url) {
-					hovering = TRUE;
-					break;
-				}
-			}
-		}
-		g_slist_free(tags);
-	}
+	if (link_store_lookup(link_store, &iter)) hovering = TRUE;
 	if (hovering != hovering_over_link) {
 		char* message = NULL;
 		hovering_over_link = hovering;
@@ -1272,17 +2498,51 @@ static void textview_change_cursor(GtkWidget* textview, gint x, gint y) {
 	}
 }
 
+/**
+ * follow the link. "@name" shows the user timeline, ">>status_id" the thread.
+ */
+static void open_link(GtkWidget* toplevel, const gchar* url, const gchar* user_id, const gchar* user_name) {
+	if (*url == '@') {
+		if (!is_processing) {
+			gchar* old_data;
+			old_data = g_object_get_data(G_OBJECT(toplevel), "user_id");
+			if (old_data) g_free(old_data);
+			old_data = g_object_get_data(G_OBJECT(toplevel), "user_name");
+			if (old_data) g_free(old_data);
+
+			g_object_set_data(G_OBJECT(toplevel), "user_id", g_strdup(user_id));
+			g_object_set_data(G_OBJECT(toplevel), "user_name", g_strdup(user_name));
+			g_object_set_data(G_OBJECT(toplevel), "combined", NULL);
+			update_friends_statuses(NULL, toplevel);
+		}
+	} else
+	if (!strncmp(url, ">>", 2)) {
+		if (!is_processing) {
+			const gchar* status_id = url+2;
+			g_object_set_data(G_OBJECT(toplevel), "status_id", g_strdup(status_id));
+			update_friends_statuses(NULL, toplevel);
+		}
+	} else {
+#ifdef _WIN32
+		ShellExecute(NULL, "open", url, NULL, NULL, SW_SHOW);
+#else
+		gchar* command = g_strdup_printf("firefox \"%s\"", url);
+		g_spawn_command_line_async(command, NULL);
+		g_free(command);
+#endif
+		gtk_widget_queue_draw(toplevel);
+	}
+}
+
 static gboolean textview_event_after(GtkWidget* textview, GdkEvent* ev) {
-	GtkWidget* toplevel;
 	GtkTextIter start, end, iter;
 	GtkTextBuffer *buffer;
 	GdkEventButton *event;
-	GSList *tags = NULL;
+	const LINK_INFO* link;
 	gint x, y;
-	int len, n;
 	gchar* url = NULL;
-	gchar* user_id = NULL;
-	gchar* user_name = NULL;
+	const gchar* user_id = NULL;
+	const gchar* user_name = NULL;
 
 	if (is_processing) return FALSE;
 
@@ -1301,66 +2561,30 @@ static gboolean textview_event_after(GtkWidget* textview, GdkEvent* ev) {
 			(gint)event->x, (gint)event->y, &x, &y);
 	gtk_text_view_get_iter_at_location(GTK_TEXT_VIEW(textview), &iter, x, y);
 
-	tags = gtk_text_iter_get_tags(&iter);
-	if (tags) {
-		len = g_slist_length(tags);
-		for(n = 0; n < len; n++) {
-			GtkTextTag* tag = (GtkTextTag*)g_slist_nth_data(tags, n);
-			if (tag) {
-				gpointer tag_data;
-				tag_data = g_object_get_data(G_OBJECT(tag), "url");
-				if (tag_data) {
-					url = g_strdup(tag_data);
-					break;
-				}
-
-				user_id = g_object_get_data(G_OBJECT(tag), "user_id");
-				user_name = g_object_get_data(G_OBJECT(tag), "user_name");
-				if (user_id || user_name) {
-					url = g_strdup_printf("@%s", user_name);
-					break;
-				}
-			}
+	link = link_store_lookup(link_store, &iter);
+	if (link) {
+		if (link->url)
+			url = g_strdup(link->url);
+		else {
+			user_id = link->user_id;
+			user_name = link->user_name;
+			url = g_strdup_printf("@%s", user_name);
 		}
-		g_slist_free(tags);
 	}
 
 	if (!url) return FALSE;
 
-	toplevel = gtk_widget_get_toplevel(textview);
-	if (*url == '@') {
-		if (!is_processing) {
-			gchar* old_data;
-			old_data = g_object_get_data(G_OBJECT(toplevel), "user_id");
-			if (old_data) g_free(old_data);
-			old_data = g_object_get_data(G_OBJECT(toplevel), "user_name");
-			if (old_data) g_free(old_data);
-
-			g_object_set_data(G_OBJECT(toplevel), "user_id", g_strdup(user_id));
-			g_object_set_data(G_OBJECT(toplevel), "user_name", g_strdup(user_name));
-			update_friends_statuses(NULL, toplevel);
-		}
-	} else
-	if (!strncmp(url, ">>", 2)) {
-		if (!is_processing) {
-			gchar* status_id = url+2;
-			g_object_set_data(G_OBJECT(toplevel), "status_id", g_strdup(status_id));
-			update_friends_statuses(NULL, toplevel);
-		}
-	} else {
-#ifdef _WIN32
-		ShellExecute(NULL, "open", url, NULL, NULL, SW_SHOW);
-#else
-		gchar* command = g_strdup_printf("firefox \"%s\"", url);
-		g_spawn_command_line_async(command, NULL);
-		g_free(command);
-#endif
-		gtk_widget_queue_draw(toplevel);
-	}
+	open_link(gtk_widget_get_toplevel(textview), url, user_id, user_name);
 	g_free(url);
 	return FALSE;
 }
 
+static void status_view_open_link(STATUS_VIEW* view, const char* link, const char* user_id, gpointer user_data) {
+	GtkWidget* toplevel = (GtkWidget*)user_data;
+	if (is_processing) return;
+	open_link(toplevel, link, user_id, *link == '@' ? link+1 : NULL);
+}
+
 static gboolean textview_motion(GtkWidget* textview, GdkEventMotion* event) {
 	gint x, y;
 	x = y = 0;
@@ -1386,42 +2610,37 @@ static gboolean textview_visibility(GtkWidget* textview, GdkEventVisibility* eve
 	return FALSE;
 }
 
-static void buffer_delete_range(GtkTextBuffer* buffer, GtkTextIter* start, GtkTextIter* end, gpointer user_data) {
-	GtkTextIter* iter = gtk_text_iter_copy(end);
-	while(iter) {
-		GSList* tags = NULL;
-		GtkTextTag* tag;
-		int len, n;
-		if (!gtk_text_iter_backward_char(iter)) break;
-		if (!gtk_text_iter_in_range(iter, start, end)) break;
-		tags = gtk_text_iter_get_tags(iter);
-		if (!tags) continue;
-		len = g_slist_length(tags);
-		for(n = 0; n < len; n++) {
-			gpointer tag_data;
-
-			tag = (GtkTextTag*)g_slist_nth_data(tags, n);
-			if (!tag) continue;
-
-			tag_data = g_object_get_data(G_OBJECT(tag), "url");
-			if (tag_data) g_free(tag_data);
-			g_object_set_data(G_OBJECT(tag), "url", NULL);
-
-			tag_data = g_object_get_data(G_OBJECT(tag), "user_id");
-			if (tag_data) g_free(tag_data);
-			g_object_set_data(G_OBJECT(tag), "user_id", NULL);
-
-			tag_data = g_object_get_data(G_OBJECT(tag), "user_name");
-			if (tag_data) g_free(tag_data);
-			g_object_set_data(G_OBJECT(tag), "user_name", NULL);
-
-			tag_data = g_object_get_data(G_OBJECT(tag), "user_description");
-			if (tag_data) g_free(tag_data);
-			g_object_set_data(G_OBJECT(tag), "user_description", NULL);
-		}
-		g_slist_free(tags);
-	}
-	gtk_text_iter_free(iter);
+/**
+ * the stored timeline and the first refresh wait for the window to be
+ * painted.
+ */
+static gboolean first_refresh(gpointer data) {
+	GtkWidget* window = (GtkWidget*)data;
+	GtkWidget* toolbox = (GtkWidget*)g_object_get_data(G_OBJECT(window), "toolbox");
+	GtkWidget* loading_image;
+
+	gdk_threads_enter();
+	/* the animation is not shown before a refresh */
+	loading_image = (GtkWidget*)g_object_get_data(G_OBJECT(window), "loading-image");
+	if (loading_image) gtk_image_set_from_file(GTK_IMAGE(loading_image), DATA_DIR"/loading.gif");
+	is_processing = TRUE;
+	gtk_widget_set_sensitive(toolbox, FALSE);
+	set_view_busy(window, TRUE);
+	process_func(show_stored_timeline_thread, window, window, _("loading statuses..."));
+	gtk_widget_set_sensitive(toolbox, TRUE);
+	set_view_busy(window, FALSE);
+	is_processing = FALSE;
+	startup_mark("refresh started");
+	update_friends_statuses(NULL, window);
+	gdk_threads_leave();
+	return FALSE;
+}
+
+static gboolean window_first_expose(GtkWidget* window, GdkEventExpose* event, gpointer user_data) {
+	g_signal_handlers_disconnect_by_func(G_OBJECT(window), G_CALLBACK(window_first_expose), user_data);
+	startup_mark("first paint");
+	g_idle_add(first_refresh, window);
+	return FALSE;
 }
 
 /**
@@ -1430,18 +2649,99 @@ static void buffer_delete_range(GtkTextBuffer* buffer, GtkTextIter* start, GtkTe
 static guint reload_timer(gpointer data) {
 	GtkWidget* window = (GtkWidget*)data;
 	gdk_threads_enter();
+	/* removed by returning 0 */
+	timer_tag = 0;
 	update_friends_statuses(NULL, window);
 	gdk_threads_leave();
 	return 0;
 }
 
+/**
+ * adapt the poll interval to the last response. new statuses shorten it,
+ * "304 Not Modified", empty pages and errors double it. Retry-After and the
+ * rate limit of the server are never run over. new_statuses is -1 when a
+ * whole timeline was loaded.
+ *
+ * refresh threads call schedule_reload. what the response said is handed
+ * to main loop, where reload_span and the timer are changed.
+ */
+typedef struct _RELOAD_HINT {
+	GtkWidget* window;
+	gboolean failed;
+	int new_statuses;
+	long status;
+	long retry_after;
+	long rate_remaining;
+	time_t rate_reset;
+} RELOAD_HINT;
+
+static guint span_from_seconds(long seconds) {
+	if (seconds < 0) return 0;
+	if (seconds >= RELOAD_TIMER_LIMIT_SPAN/1000) return RELOAD_TIMER_LIMIT_SPAN;
+	return (guint)seconds*1000;
+}
+
+static gboolean apply_reload_hint(gpointer data) {
+	RELOAD_HINT* hint = (RELOAD_HINT*)data;
+	guint span = reload_span;
+	time_t now = time(NULL);
+
+	if (hint->failed || hint->status == 0 || hint->status >= 400)
+		span = MIN(MAX(span, RELOAD_TIMER_SPAN)*2, RELOAD_TIMER_MAX_SPAN);
+	else
+	if (hint->status == 304 || hint->new_statuses == 0)
+		span = MIN(span*2, RELOAD_TIMER_MAX_SPAN);
+	else
+	if (hint->new_statuses < 0)
+		span = RELOAD_TIMER_SPAN;
+	else
+		span = MAX(span/2, RELOAD_TIMER_MIN_SPAN);
+
+	if (hint->retry_after >= 0)
+		span = MAX(span, span_from_seconds(hint->retry_after));
+	if (hint->rate_remaining >= 0 && hint->rate_reset > now) {
+		/* spread the requests left over the rest of the window */
+		long wait = (long)(hint->rate_reset - now);
+		if (hint->rate_remaining > 0) wait /= hint->rate_remaining;
+		span = MAX(span, span_from_seconds(wait));
+	}
+	reload_span = span;
+
+	/* the refresh is over and the timer was started with the old span */
+	if (timer_tag != 0) start_reload_timer(hint->window);
+	g_free(hint);
+	return FALSE;
+}
+
+static void schedule_reload(GtkWidget* window, HTTP_RESPONSE* response, gboolean failed, int new_statuses) {
+	RELOAD_HINT* hint = g_new0(RELOAD_HINT, 1);
+
+	hint->window = window;
+	hint->failed = failed;
+	hint->new_statuses = new_statuses;
+	hint->status = response->status;
+	hint->retry_after = response->retry_after;
+	hint->rate_remaining = response->rate_remaining;
+	hint->rate_reset = response->rate_reset;
+	g_idle_add(apply_reload_hint, hint);
+}
+
+/**
+ * clients polling at the same time spread out a little.
+ */
+static guint reload_span_with_jitter(void) {
+	gint jitter = reload_span * RELOAD_TIMER_JITTER / 100;
+	return reload_span + g_random_int_range(-jitter, jitter + 1);
+}
+
 static void stop_reload_timer(GtkWidget* toplevel) {
 	if (timer_tag != 0) g_source_remove(timer_tag);
+	timer_tag = 0;
 }
 
 static void start_reload_timer(GtkWidget* toplevel) {
 	stop_reload_timer(toplevel);
-	timer_tag = g_timeout_add(RELOAD_TIMER_SPAN, (GSourceFunc)reload_timer, toplevel);
+	timer_tag = g_timeout_add(reload_span_with_jitter(), (GSourceFunc)reload_timer, toplevel);
 }
 
 static void reset_reload_timer(GtkWidget* toplevel) {
@@ -1453,7 +2753,8 @@ static void config_dialog(GtkWidget* widget, gpointer user_data) {
 	gpointer result;
 	GtkWidget* window = (GtkWidget*)user_data;
 
-	login_dialog(window);
+	/* posts waiting for the account may go now */
+	if (login_dialog(window) && outbox) outbox_kick(outbox);
 }
 
 /**
@@ -1474,6 +2775,14 @@ static int load_config(GtkWidget* window) {
 			g_object_set_data(G_OBJECT(window), "mail", g_strdup(line+5));
 		if (!strncmp(line, "pass=", 5))
 			g_object_set_data(G_OBJECT(window), "pass", g_strdup(line+5));
+		if (!strncmp(line, "timeline_view=", 14))
+			use_status_view = !strcmp(line+14, "list");
+		if (!strncmp(line, "combined_timelines=", 19))
+			set_combined_sources(line+19);
+		if (!strncmp(line, "icon_fetch_parallel=", 20)) {
+			icon_fetch_parallel = atoi(line+20);
+			if (icon_fetch_parallel <= 0) icon_fetch_parallel = HTTP_FETCH_PARALLEL;
+		}
 	}
 	fclose(fp);
 	return 0;
@@ -1484,6 +2793,7 @@ static int save_config(GtkWidget* window) {
 	char* pass = (char*)g_object_get_data(G_OBJECT(window), "pass");
 	gchar* confdir = (gchar*)g_get_user_config_dir();
 	gchar* conffile = NULL;
+	gchar* combined = NULL;
 	FILE* fp = NULL;
 
 	confdir = g_build_path(G_DIR_SEPARATOR_S, confdir, APP_NAME, NULL);
@@ -1495,6 +2805,11 @@ static int save_config(GtkWidget* window) {
 	if (!fp) return -1;
 	fprintf(fp, "mail=%s\n", mail ? mail : "");
 	fprintf(fp, "pass=%s\n", pass ? pass : "");
+	fprintf(fp, "icon_fetch_parallel=%d\n", icon_fetch_parallel);
+	fprintf(fp, "timeline_view=%s\n", use_status_view ? "list" : "text");
+	combined = combined_sources_alloc();
+	fprintf(fp, "combined_timelines=%s\n", combined);
+	g_free(combined);
 	fclose(fp);
 	return 0;
 }
@@ -1502,14 +2817,119 @@ static int save_config(GtkWidget* window) {
 /**
  * main entry
  */
+/**
+ * images are compiled in, see images.h.
+ */
+static GtkWidget* inline_image(const guint8* data) {
+	GdkPixbuf* pixbuf = gdk_pixbuf_new_from_inline(-1, data, FALSE, NULL);
+	GtkWidget* image = gtk_image_new_from_pixbuf(pixbuf);
+	if (pixbuf) g_object_unref(pixbuf);
+	return image;
+}
+
+/**
+ * caches kept between runs, under dir.
+ */
+static void open_caches(const char* dir) {
+	gchar* cachedir = g_build_filename(dir, "icons", NULL);
+	icon_cache = cache_open(cachedir, ICON_CACHE_MAX_SIZE);
+	g_free(cachedir);
+	cachedir = g_build_filename(dir, "timelines", NULL);
+	timeline_cache = cache_open(cachedir, TIMELINE_CACHE_MAX_SIZE);
+	g_free(cachedir);
+	cachedir = g_build_filename(dir, "shorturls", NULL);
+	short_url_cache = cache_open(cachedir, SHORT_URL_CACHE_MAX_SIZE);
+	g_free(cachedir);
+	cachedir = g_build_filename(dir, "statuses", NULL);
+	status_store = status_store_open(cachedir, STATUS_STORE_MAX_SIZE);
+	g_free(cachedir);
+}
+
+static void close_caches(void) {
+	cache_close(icon_cache);
+	cache_close(timeline_cache);
+	cache_close(short_url_cache);
+	status_store_close(status_store);
+}
+
+/**
+ * timeline view, a list or a text view as configured. the window keeps
+ * what the timeline is rendered to.
+ */
+static GtkWidget* create_timeline_view(GtkWidget* window) {
+	GtkWidget* swin = NULL;
+	GtkWidget* textview = NULL;
+	GtkTextBuffer* buffer = NULL;
+
+	if (use_status_view) {
+		/* status viewer which has own scrollbar */
+		STATUS_VIEW* view = status_view_new();
+		status_view_set_link_func(view, status_view_open_link, window);
+		g_object_set_data(G_OBJECT(window), "statusview", view);
+		return status_view_get_widget(view);
+	}
+
+	/* status viewer on scrolled window */
+	textview = gtk_text_view_new();
+	gtk_text_view_set_editable(GTK_TEXT_VIEW(textview), FALSE);
+	gtk_text_view_set_cursor_visible(GTK_TEXT_VIEW(textview), FALSE);
+	gtk_text_view_set_wrap_mode(GTK_TEXT_VIEW(textview), GTK_WRAP_CHAR);
+	g_signal_connect(textview, "motion-notify-event", G_CALLBACK(textview_motion), NULL);
+	g_signal_connect(textview, "visibility-notify-event", G_CALLBACK(textview_visibility), NULL);
+	g_signal_connect(textview, "event-after", G_CALLBACK(textview_event_after), NULL);
+
+	swin = gtk_scrolled_window_new(NULL, NULL);
+	gtk_scrolled_window_set_policy(
+			GTK_SCROLLED_WINDOW(swin),
+			GTK_POLICY_NEVER, 
+			GTK_POLICY_AUTOMATIC);
+	gtk_container_add(GTK_CONTAINER(swin), textview);
+	g_object_set_data(G_OBJECT(window), "textview", textview);
+
+	buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(textview));
+	g_object_set_data(G_OBJECT(window), "buffer", buffer);
+
+	/* tags for string attributes */
+	gtk_text_buffer_create_tag(
+			buffer,
+			"date_tag",
+			"scale",
+			PANGO_SCALE_X_SMALL,
+			"style",
+			PANGO_STYLE_ITALIC,
+			"foreground",
+			"#005500",
+			NULL);
+	gtk_text_buffer_create_tag(
+			buffer,
+			"name_tag",
+			"scale",
+			PANGO_SCALE_LARGE,
+			"underline",
+			PANGO_UNDERLINE_SINGLE,
+			"weight",
+			PANGO_WEIGHT_BOLD,
+			"foreground",
+			"#0000FF",
+			NULL);
+	gtk_text_buffer_create_tag(
+			buffer,
+			"link_tag",
+			"foreground",
+			"blue", 
+			"underline",
+			PANGO_UNDERLINE_SINGLE, 
+			NULL);
+	link_store = link_store_new(buffer);
+	return swin;
+}
+
 int main(int argc, char* argv[]) {
 	/* widgets */
 	GtkWidget* window = NULL;
 	GtkWidget* vbox = NULL;
 	GtkWidget* hbox = NULL;
 	GtkWidget* toolbox = NULL;
-	GtkWidget* swin = NULL;
-	GtkWidget* textview = NULL;
 	GtkWidget* image = NULL;
 	GtkWidget* button = NULL;
 	GtkWidget* label = NULL;
@@ -1519,8 +2939,8 @@ int main(int argc, char* argv[]) {
 	GtkWidget* loading_image = NULL;
 	GtkWidget* loading_label = NULL;
 
-	GtkTextBuffer* buffer = NULL;
-	GtkTextTag* date_tag = NULL;
+	gchar** urls = NULL;
+	int n;
 
 #ifdef _LIBINTL_H
 	setlocale(LC_CTYPE, "");
@@ -1545,7 +2965,26 @@ int main(int argc, char* argv[]) {
 	gdk_threads_init();
 	gdk_threads_enter();
 
+	for(n = 1; n < argc; n++)
+		if (!strcmp(argv[n], "--startup-timing")) startup_timer = g_timer_new();
+
+	/* api host is connected while the window is built */
+	http_engine_init(APP_NAME);
+	urls = g_new0(gchar*, 2);
+	urls[0] = g_strdup(SERVICE_ROOT_URL);
+	start_preconnect(urls);
+	{
+		gchar* cachedir = g_build_filename(g_get_user_cache_dir(), APP_NAME, NULL);
+		open_caches(cachedir);
+		g_free(cachedir);
+	}
+	init_icon_memory();
+	status_index = status_index_new();
+	shorten_pool = g_thread_pool_new(prefetch_short_urls, NULL, 1, FALSE, NULL);
+	startup_mark("caches opened");
+
 	gtk_init(&argc, &argv);
+	startup_mark("gtk initialized");
 
 	/*------------------*/
 	/* building window. */
@@ -1554,6 +2993,8 @@ int main(int argc, char* argv[]) {
 	window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
 	gtk_window_set_title(GTK_WINDOW(window), APP_TITLE);
 	g_signal_connect(G_OBJECT(window), "delete-event", gtk_main_quit, window);
+	set_combined_sources(COMBINED_DEFAULT_SOURCES);
+	load_config(window);
 
 	/* link cursor */
 	hand_cursor = gdk_cursor_new(GDK_HAND2);
@@ -1570,43 +3011,11 @@ int main(int argc, char* argv[]) {
 	gtk_container_add(GTK_CONTAINER(window), vbox);
 
 	/* title logo */
-	image = gtk_image_new_from_pixbuf(gdk_pixbuf_new_from_file(DATA_DIR"/"SERVICE_NAME".png", NULL));
+	image = inline_image(twitter_image);
 	gtk_box_pack_start(GTK_BOX(vbox), image, FALSE, TRUE, 0);
 
-	/* status viewer on scrolled window */
-	textview = gtk_text_view_new();
-	gtk_text_view_set_editable(GTK_TEXT_VIEW(textview), FALSE);
-	gtk_text_view_set_cursor_visible(GTK_TEXT_VIEW(textview), FALSE);
-	gtk_text_view_set_wrap_mode(GTK_TEXT_VIEW(textview), GTK_WRAP_CHAR);
-	g_signal_connect(textview, "motion-notify-event", G_CALLBACK(textview_motion), NULL);
-	g_signal_connect(textview, "visibility-notify-event", G_CALLBACK(textview_visibility), NULL);
-	g_signal_connect(textview, "event-after", G_CALLBACK(textview_event_after), NULL);
-
-	swin = gtk_scrolled_window_new(NULL, NULL);
-	gtk_scrolled_window_set_policy(
-			GTK_SCROLLED_WINDOW(swin),
-			GTK_POLICY_NEVER, 
-			GTK_POLICY_AUTOMATIC);
-	gtk_container_add(GTK_CONTAINER(swin), textview);
-	gtk_container_add(GTK_CONTAINER(vbox), swin);
-	g_object_set_data(G_OBJECT(window), "textview", textview);
-
-	buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(textview));
-	g_signal_connect(G_OBJECT(buffer), "delete-range", G_CALLBACK(buffer_delete_range), NULL);
-	g_object_set_data(G_OBJECT(window), "buffer", buffer);
-
-	/* tags for string attributes */
-	date_tag = gtk_text_buffer_create_tag(
-			buffer,
-			"date_tag",
-			"scale",
-			PANGO_SCALE_X_SMALL,
-			"style",
-			PANGO_STYLE_ITALIC,
-			"foreground",
-			"#005500",
-			NULL);
-	g_object_set_data(G_OBJECT(buffer), "date_tag", date_tag);
+	/* timeline */
+	gtk_container_add(GTK_CONTAINER(vbox), create_timeline_view(window));
 
 	/* toolbox */
 	toolbox = gtk_vbox_new(FALSE, 6);
@@ -1621,7 +3030,7 @@ int main(int argc, char* argv[]) {
 	/* home button */
 	button = gtk_button_new();
 	g_signal_connect(G_OBJECT(button), "clicked", G_CALLBACK(update_self_status), window);
-	image = gtk_image_new_from_pixbuf(gdk_pixbuf_new_from_file(DATA_DIR"/home.png", NULL));
+	image = inline_image(home_image);
 	gtk_container_add(GTK_CONTAINER(button), image);
 	gtk_box_pack_start(GTK_BOX(hbox), button, FALSE, TRUE, 0);
 	gtk_tooltips_set_tip(
@@ -1630,10 +3039,22 @@ int main(int argc, char* argv[]) {
 			_("go home"),
 			_("go home"));
 
+	/* combined timeline button */
+	button = gtk_button_new();
+	g_signal_connect(G_OBJECT(button), "clicked", G_CALLBACK(update_combined_statuses), window);
+	image = gtk_image_new_from_stock(GTK_STOCK_INDEX, GTK_ICON_SIZE_BUTTON);
+	gtk_container_add(GTK_CONTAINER(button), image);
+	gtk_box_pack_start(GTK_BOX(hbox), button, FALSE, TRUE, 0);
+	gtk_tooltips_set_tip(
+			GTK_TOOLTIPS(tooltips),
+			button,
+			_("show combined timelines"),
+			_("show combined timelines"));
+
 	/* reload button */
 	button = gtk_button_new();
 	g_signal_connect(G_OBJECT(button), "clicked", G_CALLBACK(update_friends_statuses), window);
-	image = gtk_image_new_from_pixbuf(gdk_pixbuf_new_from_file(DATA_DIR"/reload.png", NULL));
+	image = inline_image(reload_image);
 	gtk_container_add(GTK_CONTAINER(button), image);
 	gtk_box_pack_start(GTK_BOX(hbox), button, FALSE, TRUE, 0);
 	gtk_tooltips_set_tip(
@@ -1645,7 +3066,7 @@ int main(int argc, char* argv[]) {
 	/* config button */
 	button = gtk_button_new();
 	g_signal_connect(G_OBJECT(button), "clicked", G_CALLBACK(config_dialog), window);
-	image = gtk_image_new_from_pixbuf(gdk_pixbuf_new_from_file(DATA_DIR"/config.png", NULL));
+	image = inline_image(config_image);
 	gtk_container_add(GTK_CONTAINER(button), image);
 	gtk_box_pack_start(GTK_BOX(hbox), button, FALSE, TRUE, 0);
 	gtk_tooltips_set_tip(
@@ -1655,7 +3076,7 @@ int main(int argc, char* argv[]) {
 			_("show config dialog"));
 
 	/* loading animation */
-	loading_image = gtk_image_new_from_file(DATA_DIR"/loading.gif");
+	loading_image = gtk_image_new();
 	if (loading_image) {
 		gtk_box_pack_start(GTK_BOX(hbox), loading_image, FALSE, TRUE, 0);
 		g_object_set_data(G_OBJECT(window), "loading-image", loading_image);
@@ -1674,6 +3095,7 @@ int main(int argc, char* argv[]) {
 	entry = gtk_entry_new();
 	g_object_set_data(G_OBJECT(window), "entry", entry);
 	g_signal_connect(G_OBJECT(entry), "activate", G_CALLBACK(on_entry_activate), window);
+	g_signal_connect(G_OBJECT(entry), "changed", G_CALLBACK(on_entry_changed), window);
 	gtk_box_pack_start(GTK_BOX(hbox), entry, TRUE, TRUE, 0);
 	/* gtk_widget_set_size_request(entry, -1, 50); */
 	gtk_tooltips_set_tip(
@@ -1685,7 +3107,7 @@ int main(int argc, char* argv[]) {
 	/* post button */
 	button = gtk_button_new();
 	g_signal_connect(G_OBJECT(button), "clicked", G_CALLBACK(post_status), window);
-	image = gtk_image_new_from_pixbuf(gdk_pixbuf_new_from_file(DATA_DIR"/post.png", NULL));
+	image = inline_image(post_image);
 	gtk_container_add(GTK_CONTAINER(button), image);
 	gtk_box_pack_start(GTK_BOX(hbox), button, FALSE, TRUE, 0);
 	gtk_tooltips_set_tip(
@@ -1694,6 +3116,18 @@ int main(int argc, char* argv[]) {
 			_("post status"),
 			_("post status"));
 
+	/* posts waiting in outbox */
+	label = gtk_label_new(NULL);
+	gtk_label_set_ellipsize(GTK_LABEL(label), PANGO_ELLIPSIZE_END);
+	gtk_label_set_max_width_chars(GTK_LABEL(label), 40);
+	g_object_set_data(G_OBJECT(window), "outbox-label", label);
+	gtk_box_pack_start(GTK_BOX(toolbox), label, FALSE, TRUE, 0);
+
+	startup_mark("window built");
+
+	/* last timeline and the network come after the first paint */
+	g_signal_connect_after(G_OBJECT(window), "expose-event", G_CALLBACK(window_first_expose), NULL);
+
 	/* request initial window size */
 	gtk_widget_set_size_request(window, 300, 400);
 	gtk_widget_show_all(vbox);
@@ -1702,7 +3136,14 @@ int main(int argc, char* argv[]) {
 	if (loading_image) gtk_widget_hide(loading_image);
 	gtk_widget_hide(loading_label);
 
-	load_config(window);
+	/* posts left by the last run are sent again */
+	{
+		gchar* path = g_build_filename(g_get_user_config_dir(), APP_NAME, "outbox", NULL);
+		posted_statuses = g_async_queue_new();
+		outbox = outbox_open(path, post_outbox_item, on_outbox_notify, window);
+		g_free(path);
+	}
+	update_outbox_label(window);
 
 	/*
 	pangoFont = pango_font_description_new();
@@ -1711,11 +3152,28 @@ int main(int argc, char* argv[]) {
 	pango_font_description_free(pangoFont);
 	*/
 
-	update_friends_statuses(window, window);
 	gtk_main();
 
 	gdk_threads_leave();
 
+	/* sender may wait for the lock, so it is closed after leaving */
+	outbox_close(outbox);
+	{
+		PREPROCESS_INFO* prepared;
+		while((prepared = (PREPROCESS_INFO*)g_async_queue_try_pop(posted_statuses))) {
+			free_timeline(prepared->statuses, prepared->times, prepared->icons, prepared->spans, prepared->rows);
+			g_free(prepared);
+		}
+		g_async_queue_unref(posted_statuses);
+	}
+	stop_shorten_timer();
+	if (shorten_pool) g_thread_pool_free(shorten_pool, TRUE, TRUE);
+	term_icon_memory();
+	status_index_free(status_index);
+	close_caches();
+	join_preconnect();
+	http_engine_cleanup();
+
 	return 0;
 }
 
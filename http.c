@@ -0,0 +1,485 @@
+#include <stdlib.h>
+#include <string.h>
+#include "http.h"
+
+/**
+ * connection engine
+ */
+static CURLSH* share = NULL;
+static GMutex* share_lock[CURL_LOCK_DATA_LAST];
+static GMutex* engine_lock = NULL;
+static GCond* engine_cond = NULL;
+static GSList* idle_handles = NULL;	/* reusable easy handles */
+static int idle_count = 0;
+static GHashTable* host_table = NULL;	/* host -> number of handles in use */
+static GHashTable* handle_host = NULL;	/* CURL* -> host */
+static char* engine_user_agent = NULL;
+static guint64 total_wire_bytes = 0;
+static guint64 total_decoded_bytes = 0;
+
+static void share_lock_func(CURL* curl, curl_lock_data data, curl_lock_access access, void* userptr) {
+	g_mutex_lock(share_lock[data]);
+}
+
+static void share_unlock_func(CURL* curl, curl_lock_data data, void* userptr) {
+	g_mutex_unlock(share_lock[data]);
+}
+
+static char* url_host_alloc(const char* url) {
+	const char* ptr = url ? strstr(url, "://") : NULL;
+	const char* tmp;
+	const char* at;
+
+	if (!url) return g_strdup("");
+	ptr = ptr ? ptr + 3 : url;
+	tmp = ptr;
+	while(*tmp && *tmp != '/' && *tmp != '?' && *tmp != '#') tmp++;
+	/* drop "user:pass@" */
+	for(at = tmp; at > ptr; at--) {
+		if (at[-1] == '@') {
+			ptr = at;
+			break;
+		}
+	}
+	return g_ascii_strdown(ptr, tmp-ptr);
+}
+
+static void setup_handle(CURL* curl) {
+	curl_easy_setopt(curl, CURLOPT_SHARE, share);
+	curl_easy_setopt(curl, CURLOPT_USERAGENT, engine_user_agent);
+	curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
+	/* handles are used from worker threads */
+	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1);
+	curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, HTTP_DNS_CACHE_TIMEOUT);
+	/* "" offers every encoding supported by libcurl */
+#if LIBCURL_VERSION_NUM >= 0x071506
+	curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");
+#else
+	curl_easy_setopt(curl, CURLOPT_ENCODING, "");
+#endif
+#if LIBCURL_VERSION_NUM >= 0x071900
+	curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+#endif
+}
+
+void http_engine_init(const char* user_agent) {
+	int n;
+
+	if (share) return;
+	curl_global_init(CURL_GLOBAL_ALL);
+
+	for(n = 0; n < CURL_LOCK_DATA_LAST; n++)
+		share_lock[n] = g_mutex_new();
+	engine_lock = g_mutex_new();
+	engine_cond = g_cond_new();
+	host_table = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	handle_host = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	engine_user_agent = g_strdup(user_agent);
+
+	share = curl_share_init();
+	curl_share_setopt(share, CURLSHOPT_LOCKFUNC, share_lock_func);
+	curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, share_unlock_func);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+}
+
+void http_engine_cleanup(void) {
+	GSList* item;
+	int n;
+
+	if (!share) return;
+	for(item = idle_handles; item; item = item->next)
+		curl_easy_cleanup((CURL*)item->data);
+	g_slist_free(idle_handles);
+	idle_handles = NULL;
+	idle_count = 0;
+
+	curl_share_cleanup(share);
+	share = NULL;
+
+	g_hash_table_destroy(handle_host);
+	g_hash_table_destroy(host_table);
+	g_cond_free(engine_cond);
+	g_mutex_free(engine_lock);
+	for(n = 0; n < CURL_LOCK_DATA_LAST; n++)
+		g_mutex_free(share_lock[n]);
+	g_free(engine_user_agent);
+	engine_user_agent = NULL;
+	curl_global_cleanup();
+}
+
+static CURL* engine_acquire(const char* url, gboolean wait) {
+	CURL* curl = NULL;
+	char* host = url_host_alloc(url);
+	int count;
+
+	g_mutex_lock(engine_lock);
+	while((count = GPOINTER_TO_INT(g_hash_table_lookup(host_table, host))) >= HTTP_MAX_HOST_CONNECTIONS) {
+		if (!wait) {
+			g_mutex_unlock(engine_lock);
+			g_free(host);
+			return NULL;
+		}
+		g_cond_wait(engine_cond, engine_lock);
+	}
+	if (idle_handles) {
+		curl = (CURL*)idle_handles->data;
+		idle_handles = g_slist_delete_link(idle_handles, idle_handles);
+		idle_count--;
+	} else {
+		curl = curl_easy_init();
+		if (curl) setup_handle(curl);
+	}
+	if (curl) {
+		g_hash_table_insert(host_table, g_strdup(host), GINT_TO_POINTER(count+1));
+		g_hash_table_insert(handle_host, curl, host);
+		host = NULL;
+	}
+	g_mutex_unlock(engine_lock);
+
+	g_free(host);
+	return curl;
+}
+
+/**
+ * take an easy handle for the url. blocks while the host already has
+ * HTTP_MAX_HOST_CONNECTIONS handles in use.
+ */
+CURL* http_engine_acquire(const char* url) {
+	return engine_acquire(url, TRUE);
+}
+
+/**
+ * same as http_engine_acquire, but returns NULL instead of blocking.
+ */
+CURL* http_engine_try_acquire(const char* url) {
+	return engine_acquire(url, FALSE);
+}
+
+/**
+ * give the handle back. the connection stays open in the shared cache.
+ */
+void http_engine_release(CURL* curl) {
+	char* host;
+	int count;
+
+	if (!curl) return;
+	curl_easy_reset(curl);
+	setup_handle(curl);
+
+	g_mutex_lock(engine_lock);
+	host = (char*)g_hash_table_lookup(handle_host, curl);
+	if (host) {
+		count = GPOINTER_TO_INT(g_hash_table_lookup(host_table, host));
+		if (count > 1)
+			g_hash_table_insert(host_table, g_strdup(host), GINT_TO_POINTER(count-1));
+		else
+			g_hash_table_remove(host_table, host);
+		g_hash_table_remove(handle_host, curl);
+	}
+	if (idle_count < HTTP_MAX_IDLE_HANDLES) {
+		idle_handles = g_slist_prepend(idle_handles, curl);
+		idle_count++;
+		curl = NULL;
+	}
+	g_cond_broadcast(engine_cond);
+	g_mutex_unlock(engine_lock);
+
+	if (curl) curl_easy_cleanup(curl);
+}
+
+/**
+ * response context
+ */
+void http_response_init(HTTP_RESPONSE* res) {
+	memset(res, 0, sizeof(HTTP_RESPONSE));
+	res->max_age = -1;
+	res->retry_after = -1;
+	res->rate_remaining = -1;
+}
+
+static void response_clear_headers(HTTP_RESPONSE* res) {
+	if (res->mime) g_free(res->mime);
+	if (res->etag) g_free(res->etag);
+	if (res->last_modified) g_free(res->last_modified);
+	res->mime = NULL;
+	res->etag = NULL;
+	res->last_modified = NULL;
+	res->max_age = -1;
+	res->retry_after = -1;
+	res->rate_remaining = -1;
+	res->rate_reset = 0;
+}
+
+void http_response_clear(HTTP_RESPONSE* res) {
+	response_clear_headers(res);
+	if (res->data) free(res->data);
+	http_response_init(res);
+}
+
+void http_response_set_sink(HTTP_RESPONSE* res, HTTP_SINK_FUNC func, gpointer user_data) {
+	res->sink = func;
+	res->sink_data = user_data;
+}
+
+/**
+ * hand the body over to the caller. release it with free().
+ */
+char* http_response_steal_data(HTTP_RESPONSE* res) {
+	char* data = res->data;
+	res->data = NULL;
+	res->size = 0;
+	res->capacity = 0;
+	return data;
+}
+
+static int response_reserve(HTTP_RESPONSE* res, size_t size) {
+	size_t capacity;
+	char* data;
+
+	/* keep one more byte for the terminator */
+	if (size < res->capacity) return TRUE;
+	capacity = res->capacity ? res->capacity : HTTP_RESPONSE_MIN_CAPACITY;
+	while(capacity <= size) capacity *= 2;
+	data = (char*)realloc(res->data, capacity);
+	if (!data) return FALSE;
+	res->data = data;
+	res->capacity = capacity;
+	return TRUE;
+}
+
+static size_t response_returned_data(char* ptr, size_t size, size_t nmemb, void* stream) {
+	HTTP_RESPONSE* res = (HTTP_RESPONSE*)stream;
+	size_t len = size*nmemb;
+
+	if (res->sink && res->status == 200) {
+		res->decoded_size += len;
+		return res->sink(ptr, len, res->sink_data) ? len : 0;
+	}
+	if (!response_reserve(res, res->size+len)) return 0;
+	memcpy(res->data+res->size, ptr, len);
+	res->size += len;
+	res->data[res->size] = 0;
+	res->decoded_size += len;
+	return len;
+}
+
+/**
+ * match "Name: value\r\n" without copying the line. returns the value and its
+ * length, or NULL when the line is another header.
+ */
+static const char* header_value(const char* line, size_t len, const char* name, size_t* value_len) {
+	size_t name_len = strlen(name);
+	const char* end = line + len;
+	const char* ptr;
+
+	if (len <= name_len || line[name_len] != ':') return NULL;
+	if (g_ascii_strncasecmp(line, name, name_len)) return NULL;
+	ptr = line + name_len + 1;
+	while(ptr < end && (*ptr == ' ' || *ptr == '\t')) ptr++;
+	while(end > ptr && (end[-1] == '\r' || end[-1] == '\n' || end[-1] == ' ' || end[-1] == '\t')) end--;
+	*value_len = end - ptr;
+	return ptr;
+}
+
+static size_t response_returned_header(void* ptr, size_t size, size_t nmemb, void* stream) {
+	HTTP_RESPONSE* res = (HTTP_RESPONSE*)stream;
+	const char* line = (const char*)ptr;
+	size_t len = size*nmemb;
+	const char* value;
+	size_t value_len;
+
+	/* headers of redirects or "100 Continue" are not ours */
+	if (len > 5 && !strncmp(line, "HTTP/", 5)) {
+		const char* code = memchr(line, ' ', len);
+		response_clear_headers(res);
+		res->status = code ? atol(code + 1) : 0;
+		return len;
+	}
+	if ((value = header_value(line, len, "Content-Type", &value_len))) {
+		const char* stop = memchr(value, ';', value_len);
+		if (stop) value_len = stop - value;
+		while(value_len && value[value_len-1] == ' ') value_len--;
+		if (res->mime) g_free(res->mime);
+		res->mime = g_strndup(value, value_len);
+	} else
+	if ((value = header_value(line, len, "Content-Length", &value_len))) {
+		guint64 length = g_ascii_strtoull(value, NULL, 10);
+		if (length > 0 && length <= HTTP_RESPONSE_MAX_PRESIZE)
+			response_reserve(res, (size_t)length);
+	} else
+	if ((value = header_value(line, len, "ETag", &value_len))) {
+		if (res->etag) g_free(res->etag);
+		res->etag = g_strndup(value, value_len);
+	} else
+	if ((value = header_value(line, len, "Last-Modified", &value_len))) {
+		if (res->last_modified) g_free(res->last_modified);
+		res->last_modified = g_strndup(value, value_len);
+	} else
+	if ((value = header_value(line, len, "Cache-Control", &value_len))) {
+		gchar* directives = g_ascii_strdown(value, value_len);
+		const char* max_age = strstr(directives, "max-age=");
+		if (strstr(directives, "no-cache") || strstr(directives, "no-store"))
+			res->max_age = 0;
+		else if (max_age)
+			res->max_age = atol(max_age + 8);
+		g_free(directives);
+	} else
+	if ((value = header_value(line, len, "Retry-After", &value_len))) {
+		/* delay in seconds or http date */
+		gchar* after = g_strndup(value, value_len);
+		if (g_ascii_isdigit(*after))
+			res->retry_after = atol(after);
+		else {
+			time_t when = curl_getdate(after, NULL);
+			if (when != -1) res->retry_after = when > time(NULL) ? (long)(when - time(NULL)) : 0;
+		}
+		g_free(after);
+	} else
+	if ((value = header_value(line, len, "X-RateLimit-Remaining", &value_len))) {
+		res->rate_remaining = atol(value);
+	} else
+	if ((value = header_value(line, len, "X-RateLimit-Reset", &value_len))) {
+		res->rate_reset = (time_t)atol(value);
+	}
+	return len;
+}
+
+void http_response_attach(CURL* curl, HTTP_RESPONSE* res) {
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, response_returned_data);
+	curl_easy_setopt(curl, CURLOPT_WRITEDATA, res);
+	curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, response_returned_header);
+	curl_easy_setopt(curl, CURLOPT_HEADERDATA, res);
+}
+
+static void response_finish(CURL* curl, HTTP_RESPONSE* res) {
+#if LIBCURL_VERSION_NUM >= 0x073700
+	curl_off_t wire_size = 0;
+	curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &wire_size);
+#else
+	double wire_size = 0;
+	curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD, &wire_size);
+#endif
+	curl_easy_getinfo(curl, CURLINFO_HTTP_CODE, &res->status);
+	res->wire_size = (size_t)wire_size;
+
+	g_mutex_lock(engine_lock);
+	total_wire_bytes += res->wire_size;
+	total_decoded_bytes += res->decoded_size;
+	g_mutex_unlock(engine_lock);
+}
+
+CURLcode http_perform(CURL* curl, HTTP_RESPONSE* res) {
+	CURLcode ret;
+
+	http_response_attach(curl, res);
+	ret = curl_easy_perform(curl);
+	if (ret == CURLE_OK)
+		response_finish(curl, res);
+	return ret;
+}
+
+/**
+ * open a connection to the host of the url before it is needed. only the
+ * headers are asked for, the connection and the name stay in the shared
+ * cache for the next request.
+ */
+void http_engine_preconnect(const char* url) {
+	CURL* curl = http_engine_try_acquire(url);
+	HTTP_RESPONSE response;
+
+	if (!curl) return;
+	http_response_init(&response);
+	curl_easy_setopt(curl, CURLOPT_URL, url);
+	curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+	curl_easy_setopt(curl, CURLOPT_TIMEOUT, HTTP_PRECONNECT_TIMEOUT);
+	http_perform(curl, &response);
+	http_engine_release(curl);
+	http_response_clear(&response);
+}
+
+/**
+ * transfer counters
+ */
+void http_get_transfer_stats(guint64* wire_bytes, guint64* decoded_bytes) {
+	g_mutex_lock(engine_lock);
+	if (wire_bytes) *wire_bytes = total_wire_bytes;
+	if (decoded_bytes) *decoded_bytes = total_decoded_bytes;
+	g_mutex_unlock(engine_lock);
+}
+
+/**
+ * parallel fetcher
+ */
+static void fetch_done(CURLM* multi, CURL* curl, CURLcode result) {
+	HTTP_FETCH* fetch = NULL;
+
+	curl_easy_getinfo(curl, CURLINFO_PRIVATE, (char**)&fetch);
+	fetch->result = result;
+	if (result == CURLE_OK)
+		response_finish(curl, &fetch->response);
+	curl_multi_remove_handle(multi, curl);
+	http_engine_release(curl);
+}
+
+void http_fetch_all(HTTP_FETCH* fetches, int count, int max_parallel) {
+	CURLM* multi;
+	CURLMsg* msg;
+	int next = 0;
+	int active = 0;
+	int running = 0;
+	int left;
+
+	if (count <= 0) return;
+	if (max_parallel <= 0) max_parallel = HTTP_FETCH_PARALLEL;
+
+	multi = curl_multi_init();
+#if LIBCURL_VERSION_NUM >= 0x071e00
+	curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, (long)HTTP_MAX_HOST_CONNECTIONS);
+#endif
+	while(next < count || active > 0) {
+		while(next < count && active < max_parallel) {
+			HTTP_FETCH* fetch = &fetches[next];
+			CURL* curl;
+
+			/* don't block on a busy host while our own transfers are running */
+			curl = active ? http_engine_try_acquire(fetch->url) : http_engine_acquire(fetch->url);
+			if (!curl) {
+				if (active) break;
+				fetch->result = CURLE_FAILED_INIT;
+				next++;
+				continue;
+			}
+			curl_easy_setopt(curl, CURLOPT_URL, fetch->url);
+			curl_easy_setopt(curl, CURLOPT_PRIVATE, fetch);
+			if (fetch->headers) curl_easy_setopt(curl, CURLOPT_HTTPHEADER, fetch->headers);
+			if (fetch->userpwd) curl_easy_setopt(curl, CURLOPT_USERPWD, fetch->userpwd);
+			http_response_attach(curl, &fetch->response);
+			curl_multi_add_handle(multi, curl);
+			active++;
+			next++;
+		}
+
+		curl_multi_perform(multi, &running);
+		while((msg = curl_multi_info_read(multi, &left))) {
+			if (msg->msg != CURLMSG_DONE) continue;
+			fetch_done(multi, msg->easy_handle, msg->data.result);
+			active--;
+		}
+		if (running) curl_multi_wait(multi, NULL, 0, 1000, NULL);
+	}
+	curl_multi_cleanup(multi);
+}
+
+void http_fetch_free(HTTP_FETCH* fetches, int count) {
+	int n;
+	for(n = 0; n < count; n++) {
+		if (fetches[n].url) free(fetches[n].url);
+		if (fetches[n].headers) curl_slist_free_all(fetches[n].headers);
+		http_response_clear(&fetches[n].response);
+	}
+	free(fetches);
+}
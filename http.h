@@ -0,0 +1,94 @@
+#ifndef _HTTP_H_
+#define _HTTP_H_
+
+#include <glib.h>
+#include <time.h>
+#include <curl/curl.h>
+
+#define HTTP_MAX_HOST_CONNECTIONS  4
+#define HTTP_MAX_IDLE_HANDLES      16
+#define HTTP_DNS_CACHE_TIMEOUT     (10*60)
+#define HTTP_FETCH_PARALLEL        8
+#define HTTP_PRECONNECT_TIMEOUT    10
+#define HTTP_RESPONSE_MIN_CAPACITY 4096
+#define HTTP_RESPONSE_MAX_PRESIZE  (16*1024*1024)
+
+/**
+ * connection engine
+ *
+ * every easy handle handed out by the engine is attached to one process-wide
+ * share handle, so keep-alive connections, resolved addresses and TLS
+ * sessions survive from one request to the next.
+ */
+void http_engine_init(const char* user_agent);
+void http_engine_cleanup(void);
+CURL* http_engine_acquire(const char* url);
+CURL* http_engine_try_acquire(const char* url);
+void http_engine_release(CURL* curl);
+void http_engine_preconnect(const char* url);
+
+/**
+ * response context
+ *
+ * one per request, passed to curl through CURLOPT_WRITEDATA and
+ * CURLOPT_HEADERDATA. the body buffer grows geometrically, is pre-sized from
+ * Content-Length and is always NUL terminated.
+ *
+ * when a sink is set, the body of a "200 OK" response is passed to it as it
+ * arrives instead of being buffered. returning FALSE aborts the transfer.
+ */
+typedef gboolean (*HTTP_SINK_FUNC)(const char* data, size_t size, gpointer user_data);
+
+typedef struct _HTTP_RESPONSE {
+	long status;		/* http status code */
+	char* mime;		/* content-type. ex: "text/html" */
+	char* etag;		/* ETag */
+	char* last_modified;	/* Last-Modified */
+	long max_age;		/* Cache-Control max-age, or -1 */
+	long retry_after;	/* Retry-After in seconds, or -1 */
+	long rate_remaining;	/* X-RateLimit-Remaining, or -1 */
+	time_t rate_reset;	/* X-RateLimit-Reset, or 0 */
+	char* data;		/* response body */
+	size_t size;		/* size of body */
+	size_t capacity;	/* allocated size of data */
+	size_t wire_size;	/* size of body on the wire (before decoding) */
+	size_t decoded_size;	/* size of body after decoding */
+	HTTP_SINK_FUNC sink;
+	gpointer sink_data;
+} HTTP_RESPONSE;
+
+void http_response_init(HTTP_RESPONSE* res);
+void http_response_clear(HTTP_RESPONSE* res);
+void http_response_set_sink(HTTP_RESPONSE* res, HTTP_SINK_FUNC func, gpointer user_data);
+void http_response_attach(CURL* curl, HTTP_RESPONSE* res);
+char* http_response_steal_data(HTTP_RESPONSE* res);
+CURLcode http_perform(CURL* curl, HTTP_RESPONSE* res);
+
+/**
+ * transfer counters
+ *
+ * bodies are requested with every content-coding libcurl was built with
+ * (gzip, deflate and br where available) and decoded while they stream in.
+ * the counters sum up the body bytes of all finished requests.
+ */
+void http_get_transfer_stats(guint64* wire_bytes, guint64* decoded_bytes);
+
+/**
+ * parallel fetcher
+ *
+ * downloads every url of the array at once through curl_multi, keeping at
+ * most max_parallel transfers in flight. returns when all of them finished.
+ */
+typedef struct _HTTP_FETCH {
+	char* url;		/* request url (escaped) */
+	struct curl_slist* headers;	/* extra request headers, or NULL */
+	const char* userpwd;	/* "user:password" for basic auth, or NULL */
+	gpointer user_data;
+	CURLcode result;	/* transfer result */
+	HTTP_RESPONSE response;
+} HTTP_FETCH;
+
+void http_fetch_all(HTTP_FETCH* fetches, int count, int max_parallel);
+void http_fetch_free(HTTP_FETCH* fetches, int count);
+
+#endif /* _HTTP_H_ */
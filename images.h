@@ -0,0 +1,2702 @@
+/* GdkPixbuf RGBA C-Source image dump */
+
+#ifdef __SUNPRO_C
+#pragma align 4 (twitter_image)
+#endif
+#ifdef __GNUC__
+static const guint8 twitter_image[] __attribute__ ((__aligned__ (4))) = 
+#else
+static const guint8 twitter_image[] = 
+#endif
+{ ""
+  /* Pixbuf magic (0x47646b50) */
+  "GdkP"
+  /* length: header (24) + pixel_data (41160) */
+  "\000\000\240\340"
+  /* pixdata_type (0x1010002) */
+  "\001\001\000\002"
+  /* rowstride (840) */
+  "\000\000\003H"
+  /* width (210) */
+  "\000\000\000\322"
+  /* height (49) */
+  "\000\000\0001"
+  /* pixel_data: */
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\004\377\377\3771\377\377\377z\377\377\377\272"
+  "\377\377\377\321\377\377\377\302\377\377\377\224\377\377\377D\377\377"
+  "\377\014\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\014\377\377\377D\377\377\377\226\377\377\377\314\377\377\377\334\377"
+  "\377\377\305\377\377\377\214\377\377\377=\377\377\377\010\377\377\377"
+  "\000\375\374\376\000\376\375\377\000\377\377\377\000\377\377\377\014"
+  "\377\377\377A\377\377\377\217\377\377\377\304\377\377\377\321\377\377"
+  "\377\271\377\377\377{\377\377\3771\377\377\377\003\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\014\377"
+  "\377\377A\377\377\377\215\377\377\377\304\377\377\377\320\377\377\377"
+  "\271\377\377\377\201\377\377\3773\377\377\377\004\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377<\377"
+  "\377\377\275\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\330\377\377\377Y\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377X\377\377\377\330\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\313\377\377\377C\375"
+  "\374\376\000\376\375\377\001\377\377\377W\377\377\377\327\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\270\377\377\3778\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\002\377\377\377\134\377\377\377\327\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\275\377\377\3778\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377t\377\377\377\374\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\230\377\377\377\006\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\003\377\377\377\225\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\371\376\376\377\223\376\376\377\253\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\372\377\377\377o\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\011\377\377\377\243\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\367\377\377\377h\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377v\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\253"
+  "\377\377\377\003\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\232\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377p\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\002\377\377\377\255\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377u\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377B\377\377\377\375\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\375\377"
+  "\377\377\354\374\377\377\343\373\377\377\350\374\377\377\371\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377{\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377g\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\371\376\377\377\345\373\377"
+  "\377\337\373\377\377\347\374\377\377\374\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\371\376\377\377\346\373"
+  "\377\377\341\373\377\377\352\374\377\377\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\374"
+  "\377\377\377>\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377{\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\371\376\377\377\346\373"
+  "\377\377\341\373\377\377\352\374\377\377\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\375"
+  "\377\377\377D\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\004\377\377\377\303\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\353\374\377\377"
+  "\276\365\377\377\257\363\377\377\260\363\377\377\255\363\377\377\265"
+  "\364\377\377\337\372\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\362\377\377\377#\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\022\377\377\377\342\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\341\373\377\377\270\364\377\377"
+  "\274\365\377\377\306\366\377\377\273\365\377\377\273\365\377\377\344"
+  "\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\334\372\377\377\272\364\377"
+  "\377\277\365\377\377\306\366\377\377\272\365\377\377\277\365\377\377"
+  "\354\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\303\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377$\377\377\377\355\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\336\372\377\377\274\365"
+  "\377\377\300\366\377\377\305\366\377\377\270\364\377\377\275\365\377"
+  "\377\353\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\310\377\377\377\001\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377;\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\353\374\377\377"
+  "\254\362\377\377\266\363\377\377\312\367\377\377\316\367\377\377\312"
+  "\367\377\377\270\364\377\377\246\361\377\377\332\371\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\200\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377v\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\333\371\377\377\252\361\377\377"
+  "\272\364\377\377\306\366\377\377\307\366\377\377\306\366\377\377\271"
+  "\364\377\377\254\362\377\377\343\372\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\327\371\377\377\253\362\377"
+  "\377\274\364\377\377\307\366\377\377\307\366\377\377\305\366\377\377"
+  "\265\363\377\377\257\362\377\377\354\374\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\077\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377w\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\331\371\377\377\254\362"
+  "\377\377\275\364\377\377\307\366\377\377\307\366\377\377\305\366\377"
+  "\377\264\363\377\377\256\362\377\377\352\374\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377D\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\210\377\377\377\377\377\377\377\377\377\377\377\377\375\377\377\377"
+  "\272\364\376\377\255\362\376\377\271\363\376\377\267\363\376\377\266"
+  "\363\376\377\267\363\376\377\270\363\376\377\260\362\376\377\253\361"
+  "\376\377\363\375\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\314\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\306\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\364\375\377\377\255\362\376"
+  "\377\262\362\376\377\266\363\376\377\264\363\376\377\264\363\376\377"
+  "\264\363\376\377\266\363\376\377\261\362\376\377\264\363\376\377\372"
+  "\376\377\377\377\377\377\377\377\377\377\377\360\375\377\377\255\362"
+  "\376\377\264\363\376\377\266\363\376\377\264\363\376\377\264\363\376"
+  "\377\265\363\376\377\267\363\376\377\255\362\376\377\272\364\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\215\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\304\377\377\377\377\377\377\377\377\377\377\377\377\361\375\377\377"
+  "\256\362\376\377\264\363\376\377\266\363\376\377\264\363\376\377\264"
+  "\363\376\377\265\363\376\377\267\363\376\377\255\362\376\377\271\363"
+  "\376\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\222\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\303\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\347\373\377\377\247\360\376\377\264\362\376\377\264\362"
+  "\376\377\264\362\376\377\264\362\376\377\264\362\376\377\264\362\376"
+  "\377\264\362\376\377\245\360\376\377\332\371\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\345\377\377\377\015\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\012\377\377\377\337\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\336\372\377\377\247\360\376\377\265\362\376\377\264\362\376\377\264"
+  "\362\376\377\264\362\376\377\264\362\376\377\264\362\376\377\264\362"
+  "\376\377\247\360\376\377\343\372\377\377\377\377\377\377\377\377\377"
+  "\377\331\371\377\377\250\360\376\377\265\362\376\377\264\362\376\377"
+  "\264\362\376\377\264\362\376\377\264\362\376\377\264\362\376\377\263"
+  "\362\376\377\252\361\376\377\360\375\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\256\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\026\377\377\377\356\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\321\370\377\377\250\360\376\377\265\362\376\377\264\362"
+  "\376\377\264\362\376\377\264\362\376\377\264\362\376\377\264\362\376"
+  "\377\263\362\376\377\251\360\376\377\356\374\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\262\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\330\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\337\372\377\377\246\360\376"
+  "\377\263\362\376\377\262\362\376\377\262\362\376\377\262\362\376\377"
+  "\262\362\376\377\262\362\376\377\263\362\376\377\245\360\376\377\314"
+  "\366\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\362\377\377\3774\377\377\377\033\377\377\377 \377\377\377 \377"
+  "\377\377 \377\377\377 \377\377\377 \377\377\377 \377\377\377 \377\377"
+  "\377 \377\377\377 \377\377\377\021\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\020"
+  "\377\377\377\351\377\377\377\377\377\377\377\377\377\377\377\377\321"
+  "\367\377\377\245\360\376\377\263\362\376\377\262\362\376\377\262\362"
+  "\376\377\262\362\376\377\262\362\376\377\262\362\376\377\263\362\376"
+  "\377\247\360\376\377\334\371\377\377\377\377\377\377\377\377\377\377"
+  "\322\367\377\377\250\360\376\377\263\362\376\377\262\362\376\377\262"
+  "\362\376\377\262\362\376\377\262\362\376\377\262\362\376\377\262\362"
+  "\376\377\245\357\376\377\347\373\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\270\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377 \377\377\377\365\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\311\366\377\377\251\360\376\377\263\362\376\377\262\362\376\377"
+  "\262\362\376\377\262\362\376\377\262\362\376\377\262\362\376\377\262"
+  "\362\376\377\244\357\376\377\342\372\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\301\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\331\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\337\371\377\377\244\357\376\377\261"
+  "\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377\260\361"
+  "\376\377\260\361\376\377\261\361\376\377\243\357\376\377\313\366\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\366\377\377\377\365\377\377\377\365\377\377\377\365\377"
+  "\377\377\365\377\377\377\365\377\377\377\365\377\377\377\365\377\377"
+  "\377\365\377\377\377\365\377\377\377\366\377\377\377\352\377\377\377"
+  "\257\377\377\377^\377\377\377\017\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\012\377\377\377\340\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\333\371\377\377\243\357\376\377\261\361\376\377\260"
+  "\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377\260\361"
+  "\376\377\261\361\376\377\242\356\376\377\341\372\377\377\377\377\377"
+  "\377\377\377\377\377\314\366\377\377\245\357\376\377\261\361\376\377"
+  "\260\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377\260"
+  "\361\376\377\260\361\376\377\242\357\376\377\347\373\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\267\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377'\377\377\377\371\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\305\365\377\377\246\357\376\377\261\361\376"
+  "\377\260\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377"
+  "\260\361\376\377\260\361\376\377\241\357\376\377\342\372\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\303\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\331\377\377\377\377\377\377\377\377\377\377\377\377\336\371\376\377"
+  "\240\356\375\377\257\360\375\377\260\360\375\377\257\360\375\377\257"
+  "\360\375\377\257\360\375\377\260\360\375\377\257\360\375\377\236\355"
+  "\375\377\313\365\376\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\377\377\377R"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\006\377"
+  "\377\377\035\377\377\3770\377\377\377!\377\377\377\007\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\003\377\377\377\030\377\377\377.\377\377\377(\377\377\377\016\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\001\377\377\377\021\377\377\377+\377\377\377,\377\377\377\020"
+  "\377\377\377\000\377\377\377\312\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\361\375\377\377\244\356\375\377\253\357\375\377\261\360"
+  "\375\377\260\360\375\377\257\360\375\377\260\360\375\377\261\360\375"
+  "\377\251\357\375\377\253\360\375\377\370\376\377\377\377\377\377\377"
+  "\377\377\377\377\305\364\376\377\237\355\375\377\257\360\375\377\260"
+  "\360\375\377\260\360\375\377\257\360\375\377\260\360\375\377\261\360"
+  "\375\377\251\357\375\377\236\355\375\377\347\373\376\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\267\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\3770\377\377\377\376\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\301\364\376\377\237\355\375\377\257\360\375\377"
+  "\260\360\375\377\260\360\375\377\257\360\375\377\260\360\375\377\261"
+  "\360\375\377\251\357\375\377\235\355\375\377\341\372\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\302\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\002\377\377\377\006\377\377\377\011\377"
+  "\377\377\011\377\377\377\004\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\003\377\377\377\010"
+  "\377\377\377\011\377\377\377\011\377\377\377\011\377\377\377\011\377"
+  "\377\377\011\377\377\377\011\377\377\377\011\377\377\377\010\377\377"
+  "\377\001\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\331"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\336\371\376\377\233"
+  "\354\375\377\245\356\375\377\255\357\375\377\256\357\375\377\256\357"
+  "\375\377\256\357\375\377\255\357\375\377\245\356\375\377\232\354\375"
+  "\377\312\365\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377x\377\377\3772\377\377\377\237\377\377\377\334\377\377\377"
+  "\363\377\377\377\376\377\377\377\365\377\377\377\340\377\377\377\257"
+  "\377\377\377;\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\032\377\377\377\202\377\377\377\325"
+  "\377\377\377\357\377\377\377\376\377\377\377\372\377\377\377\347\377"
+  "\377\377\301\377\377\377X\377\377\377\010\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\015\377\377\377h\377\377"
+  "\377\312\377\377\377\351\377\377\377\374\377\377\377\374\377\377\377"
+  "\351\377\377\377\313\377\377\377\357\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\322\367\376\377\234\354\375\377\247"
+  "\356\375\377\255\357\375\377\256\357\375\377\256\357\375\377\246\356"
+  "\375\377\235\354\375\377\332\370\376\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\277\363\376\377\233\354\375\377\244\356\375\377"
+  "\253\357\375\377\256\357\375\377\256\357\375\377\255\357\375\377\251"
+  "\357\375\377\240\355\375\377\234\354\375\377\346\372\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\267\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\3776\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\275\363\376\377\233\354\375\377\244\356\375"
+  "\377\253\357\375\377\256\357\375\377\256\357\375\377\255\357\375\377"
+  "\250\357\375\377\241\355\375\377\234\354\375\377\341\371\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\302\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\007\377\377\377*\377\377\377[\377\377\377\233\377"
+  "\377\377\302\377\377\377\321\377\377\377\331\377\377\377\336\377\377"
+  "\377\335\377\377\377\326\377\377\377\314\377\377\377\265\377\377\377"
+  "\203\377\377\377E\377\377\377\035\377\377\377\002\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\026\377\377\377F\377\377"
+  "\377\217\377\377\377\303\377\377\377\323\377\377\377\334\377\377\377"
+  "\335\377\377\377\335\377\377\377\335\377\377\377\335\377\377\377\335"
+  "\377\377\377\335\377\377\377\335\377\377\377\334\377\377\377\316\377"
+  "\377\377\224\377\377\3773\377\377\377\003\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\331\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\336\371\376\377\233\353\375\377\236"
+  "\354\375\377\241\355\375\377\246\356\375\377\247\356\375\377\246\356"
+  "\375\377\241\355\375\377\236\354\375\377\231\353\375\377\312\365\376"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\245\377\377\377\024\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377j\377\377\377\355\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\310\377\377\377*\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377=\377\377\377\327\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\326\367\376\377\244\356\375"
+  "\377\233\354\375\377\235\354\375\377\233\354\375\377\247\356\375\377"
+  "\332\370\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\271\361\376\377\233\353\375\377\236\354\375\377\237\355"
+  "\375\377\241\355\375\377\243\355\375\377\241\355\375\377\236\355\375"
+  "\377\236\354\375\377\234\353\375\377\346\372\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\267\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377;\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\272\362\376\377\232\353\375\377\236\354\375\377\237"
+  "\355\375\377\241\355\375\377\243\355\375\377\240\355\375\377\236\354"
+  "\375\377\237\354\375\377\233\353\375\377\340\371\376\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\302\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377$\377\377\377{\377\377"
+  "\377\321\377\377\377\375\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\367\377\377\377\270\377\377\377a\377\377\377"
+  "\025\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\3773\377\377\377\235\377\377\377\360\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\261\377\377\377\042\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\331\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\335\370\376\377\230\353\375\377\235\354"
+  "\375\377\234\354\375\377\234\354\375\377\234\354\375\377\234\354\375"
+  "\377\234\354\375\377\235\354\375\377\232\354\374\377\254\357\374\377"
+  "\307\364\376\377\305\364\376\377\305\364\376\377\305\364\376\377\305"
+  "\364\376\377\305\364\376\377\305\364\376\377\305\364\376\377\305\364"
+  "\376\377\305\364\376\377\305\364\376\377\305\364\376\377\305\364\376"
+  "\377\305\364\376\377\304\363\375\377\322\366\375\377\370\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\315\377\377\377\031\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\222\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\356\377\377\377G\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377W\377\377\377\367\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\364\375\377"
+  "\377\334\370\376\377\326\367\376\377\336\371\376\377\367\375\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\266\361\375\377\230\353\375\377\235\354\375\377\235\354"
+  "\375\377\234\354\375\377\234\354\375\377\234\354\375\377\235\354\375"
+  "\377\235\354\375\377\231\353\375\377\346\372\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\356\377\377\377\300\377"
+  "\377\377\302\377\377\377\302\377\377\377\302\377\377\377\303\377\377"
+  "\377\263\377\377\377\276\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\267\361\376\377\230\353\375\377\235\354\375\377"
+  "\235\354\375\377\234\354\375\377\234\354\375\377\234\354\375\377\235"
+  "\354\375\377\235\354\375\377\231\353\375\377\340\371\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\361\377\377\377"
+  "\301\377\377\377\302\377\377\377\302\377\377\377\302\377\377\377\303"
+  "\377\377\377\271\377\377\377\235\377\377\377^\377\377\377\013\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\025\377\377\377\221\377\377\377\362\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\344\377\377\377x\377\377\377\012\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\034\377\377\377\242"
+  "\377\377\377\372\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\347\377"
+  "\377\377;\377\377\377\000\377\377\377\000\377\377\377\331\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\334\370\376\377\226\352\374\377"
+  "\233\353\374\377\233\353\374\377\233\353\374\377\233\353\374\377\233"
+  "\353\374\377\233\353\374\377\232\353\374\377\235\354\374\377\254\357"
+  "\374\377\272\362\375\377\274\362\375\377\274\362\375\377\274\362\375"
+  "\377\274\362\375\377\274\362\375\377\274\362\375\377\274\362\375\377"
+  "\274\362\375\377\274\362\375\377\274\362\375\377\274\362\375\377\274"
+  "\362\375\377\274\362\375\377\272\362\375\377\246\355\374\377\246\355"
+  "\374\377\342\371\376\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\276\377\377"
+  "\377\005\377\377\377\000\377\377\377\000\377\377\377v\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\354\377\377\377+\377\377\377\000\377\377\377\000\377\377\377B\377\377"
+  "\377\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\261\357\375\377\227\352\374\377\233\353\374\377\233"
+  "\353\374\377\233\353\374\377\233\353\374\377\233\353\374\377\233\353"
+  "\374\377\233\353\374\377\227\352\374\377\345\372\376\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\265\360\375\377\226\352\374\377\233\353\374"
+  "\377\233\353\374\377\233\353\374\377\233\353\374\377\233\353\374\377"
+  "\233\353\374\377\233\353\374\377\227\352\374\377\337\371\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\340"
+  "\377\377\377_\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377M\377\377\377\343\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\330\377\377\377>\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377T\377\377\377\350\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\347\377\377\377(\377\377\377\000\377\377\377\331\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\333\370\376\377\224\351\374\377\231"
+  "\352\374\377\231\352\374\377\231\352\374\377\231\352\374\377\231\352"
+  "\374\377\231\352\374\377\231\352\374\377\253\356\375\377\267\360\375"
+  "\377\266\360\375\377\266\360\375\377\266\360\375\377\266\360\375\377"
+  "\266\360\375\377\266\360\375\377\266\360\375\377\266\360\375\377\266"
+  "\360\375\377\266\360\375\377\266\360\375\377\266\360\375\377\266\360"
+  "\375\377\266\360\375\377\266\360\375\377\267\360\375\377\245\355\374"
+  "\377\231\352\374\377\353\373\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\353\373\377\377\307\364\375\377\273"
+  "\362\375\377\305\364\375\377\346\372\376\377\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377{"
+  "\377\377\377\000\377\377\377&\377\377\377\360\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\363\375\377\377\317\365\375"
+  "\377\273\362\375\377\276\362\375\377\333\370\376\377\373\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\272\377\377\377\000\377\377\377\005\377\377\377\321\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\371\376\377"
+  "\377\331\367\376\377\275\362\375\377\274\362\375\377\324\366\375\377"
+  "\367\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\256\356\375\377\225\351\374\377\231\352\374\377\231"
+  "\352\374\377\231\352\374\377\231\352\374\377\231\352\374\377\231\352"
+  "\374\377\231\352\374\377\225\351\374\377\345\372\376\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\263\357\375\377\224\351\374\377\231\352\374"
+  "\377\231\352\374\377\231\352\374\377\231\352\374\377\231\352\374\377"
+  "\231\352\374\377\231\352\374\377\225\351\374\377\337\370\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\225\377\377\377\000\377\377\377s\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\367\376\377\377"
+  "\355\374\377\377\347\373\377\377\340\372\377\377\335\372\377\377\336"
+  "\372\377\377\343\372\377\377\352\374\377\377\360\374\377\377\372\376"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\374"
+  "\377\377\377m\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\200\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\371\376\377\377\355\373\377\377\343\372\376\377\331\370\376\377\330"
+  "\370\376\377\330\370\376\377\330\370\376\377\330\370\376\377\331\370"
+  "\376\377\331\370\376\377\331\370\376\377\334\370\376\377\354\374\376"
+  "\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\264\377\377\377\000\377\377\377\331\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\333\370\376\377\223\351"
+  "\374\377\230\352\374\377\230\352\374\377\230\352\374\377\230\352\374"
+  "\377\230\352\374\377\227\352\374\377\236\353\374\377\247\355\374\377"
+  "\245\355\374\377\245\355\374\377\245\355\374\377\245\355\374\377\245"
+  "\355\374\377\245\355\374\377\245\355\374\377\245\355\374\377\245\355"
+  "\374\377\245\355\374\377\245\355\374\377\245\355\374\377\245\355\374"
+  "\377\245\355\374\377\245\355\374\377\245\355\374\377\245\355\374\377"
+  "\247\355\374\377\227\352\374\377\263\357\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\314\365\375\377\242\354\374\377\263\360"
+  "\375\377\302\363\375\377\266\361\375\377\242\355\374\377\301\363\375"
+  "\377\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\342\377\377\377\004\377\377\377\220\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\337\371\376\377\244\355"
+  "\374\377\255\357\375\377\300\363\375\377\273\362\375\377\246\356\374"
+  "\377\263\360\375\377\366\375\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\3774\377\377\377T\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\357\374\376\377"
+  "\254\357\375\377\247\355\375\377\274\362\375\377\277\362\375\377\253"
+  "\356\375\377\252\356\374\377\352\373\376\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\374\376\377\377\366\375\377\377\375\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\256\356\375\377\224\351\374\377\230\352"
+  "\374\377\230\352\374\377\230\352\374\377\230\352\374\377\230\352\374"
+  "\377\230\352\374\377\230\352\374\377\224\351\374\377\344\372\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\263\357\375\377\223\351\374\377"
+  "\230\352\374\377\230\352\374\377\230\352\374\377\230\352\374\377\230"
+  "\352\374\377\230\352\374\377\230\352\374\377\224\351\374\377\337\371"
+  "\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\376\377\377\377\343\377\377"
+  "\377\372\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\364\375\377\377\332\371\377\377\276\364\376\377"
+  "\257\362\376\377\265\363\376\377\273\364\377\377\277\364\377\377\303"
+  "\365\377\377\304\365\377\377\301\365\377\377\275\364\377\377\272\364"
+  "\377\377\266\363\376\377\310\366\377\377\342\372\377\377\372\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\205\377\377\377\000\377"
+  "\377\377\000\377\377\377\211\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\352\373\376"
+  "\377\305\363\375\377\243\355\374\377\233\353\374\377\233\353\374\377"
+  "\235\354\374\377\236\354\374\377\236\354\374\377\235\354\374\377\235"
+  "\354\374\377\235\353\374\377\235\353\374\377\231\353\374\377\225\352"
+  "\374\377\230\352\374\377\275\362\375\377\371\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377C\377"
+  "\377\377\331\377\377\377\377\377\377\377\377\377\377\377\377\332\367"
+  "\376\377\221\350\374\377\226\351\374\377\226\351\374\377\226\351\374"
+  "\377\226\351\374\377\226\351\374\377\226\351\374\377\242\353\374\377"
+  "\245\354\374\377\244\354\374\377\244\354\374\377\244\354\374\377\244"
+  "\354\374\377\244\354\374\377\244\354\374\377\244\354\374\377\244\354"
+  "\374\377\244\354\374\377\244\354\374\377\244\354\374\377\244\354\374"
+  "\377\244\354\374\377\244\354\374\377\244\354\374\377\244\354\374\377"
+  "\244\354\374\377\245\354\374\377\237\353\374\377\237\353\374\377\371"
+  "\376\377\377\377\377\377\377\324\366\376\377\226\352\374\377\252\356"
+  "\374\377\257\357\375\377\255\357\375\377\256\357\375\377\254\357\375"
+  "\377\230\353\374\377\311\364\375\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\372\370\376\203\376\376\377\327\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\355\373\377\377\235\353"
+  "\374\377\245\355\374\377\257\357\375\377\255\357\375\377\256\357\375"
+  "\377\256\357\375\377\234\353\374\377\265\360\375\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\371\367\376\246\373"
+  "\372\376\264\377\377\377\377\377\377\377\377\377\377\377\377\374\377"
+  "\377\377\253\356\375\377\237\354\374\377\257\357\375\377\256\357\375"
+  "\377\255\357\375\377\257\357\375\377\242\354\374\377\243\355\374\377"
+  "\365\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\363\375\377\377\301\362\375\377\256\356\374\377\254\356"
+  "\374\377\260\357\374\377\304\363\375\377\366\375\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\254\356\375\377"
+  "\222\350\374\377\226\351\374\377\226\351\374\377\225\351\373\377\224"
+  "\351\373\377\223\351\373\377\223\351\373\377\223\351\373\377\220\350"
+  "\373\377\310\364\375\377\336\371\376\377\333\370\376\377\333\370\376"
+  "\377\333\370\376\377\333\370\376\377\333\370\376\377\333\370\376\377"
+  "\333\370\376\377\332\370\376\377\345\372\376\377\373\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\261\357"
+  "\375\377\221\350\374\377\226\351\374\377\226\351\374\377\225\351\373"
+  "\377\223\350\373\377\223\350\373\377\223\350\373\377\223\350\373\377"
+  "\220\347\373\377\304\363\375\377\337\371\376\377\333\370\376\377\333"
+  "\370\376\377\333\370\376\377\333\370\376\377\333\370\376\377\333\370"
+  "\376\377\333\370\376\377\332\370\376\377\344\372\376\377\373\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\367\376\377\377\313\366\377\377\253\361\376\377\244\360"
+  "\376\377\257\362\376\377\274\364\376\377\305\365\376\377\307\365\376"
+  "\377\307\366\376\377\307\366\376\377\307\366\376\377\307\366\376\377"
+  "\307\365\376\377\305\365\376\377\276\364\376\377\260\362\376\377\246"
+  "\360\376\377\263\362\376\377\330\370\377\377\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377u\377\377\377u\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\363\375\377\377\274\361\375"
+  "\377\227\352\374\377\234\353\374\377\256\357\375\377\267\360\375\377"
+  "\275\362\375\377\300\362\375\377\276\362\375\377\274\362\375\377\273"
+  "\361\375\377\271\361\375\377\267\361\375\377\266\360\375\377\262\360"
+  "\375\377\250\355\374\377\233\353\374\377\220\350\374\377\267\360\375"
+  "\377\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\253\377\377\377\331\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\331\367\376\377\216\347\373\377\223\350\373\377\223\350"
+  "\373\377\223\350\373\377\223\350\373\377\223\350\373\377\224\350\373"
+  "\377\241\353\374\377\243\353\374\377\243\353\374\377\243\353\374\377"
+  "\243\353\374\377\243\353\374\377\243\353\374\377\243\353\374\377\243"
+  "\353\374\377\243\353\374\377\243\353\374\377\243\353\374\377\243\353"
+  "\374\377\243\353\374\377\243\353\374\377\243\353\374\377\243\353\374"
+  "\377\243\353\374\377\243\353\374\377\243\353\374\377\237\352\374\377"
+  "\233\352\373\377\370\376\377\377\377\377\377\377\250\355\375\377\240"
+  "\353\374\377\245\354\374\377\244\354\374\377\244\354\374\377\244\354"
+  "\374\377\244\354\374\377\242\353\374\377\243\354\374\377\372\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\300"
+  "\362\375\377\232\352\374\377\245\354\374\377\244\354\374\377\244\354"
+  "\374\377\244\354\374\377\244\354\374\377\245\354\374\377\231\352\374"
+  "\377\346\372\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\327\367\376\377\227\351\374\377\245\354\374\377\244\354"
+  "\374\377\244\354\374\377\244\354\374\377\244\354\374\377\246\354\374"
+  "\377\231\352\374\377\316\365\376\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\351\373\376\377\236\353\373\377\240\353\374\377\267"
+  "\357\374\377\275\361\375\377\265\357\374\377\236\352\373\377\244\354"
+  "\374\377\361\374\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\256\356\374\377\216\347\373\377\223\350\373\377\222\350\373\377"
+  "\226\351\373\377\241\353\373\377\252\355\374\377\252\355\374\377\252"
+  "\355\374\377\252\355\374\377\247\354\374\377\246\354\374\377\246\354"
+  "\374\377\246\354\374\377\246\354\374\377\246\354\374\377\246\354\374"
+  "\377\246\354\374\377\246\354\374\377\245\354\374\377\236\353\373\377"
+  "\243\354\374\377\327\367\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\257\356\374\377\216\347\373\377\223\350\373\377\222\350"
+  "\373\377\230\351\373\377\246\354\374\377\257\356\374\377\257\356\374"
+  "\377\257\356\374\377\257\356\374\377\254\355\374\377\252\355\374\377"
+  "\252\355\374\377\252\355\374\377\252\355\374\377\252\355\374\377\252"
+  "\355\374\377\252\355\374\377\252\355\374\377\250\355\374\377\236\353"
+  "\373\377\241\353\374\377\325\366\376\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\347\373\377\377\256\361\376\377\240\357\376\377\252"
+  "\360\376\377\262\361\376\377\264\362\376\377\263\362\376\377\262\361"
+  "\376\377\262\361\376\377\262\361\376\377\262\361\376\377\262\361\376"
+  "\377\262\361\376\377\262\361\376\377\262\361\376\377\263\362\376\377"
+  "\264\362\376\377\263\362\376\377\252\360\376\377\241\357\376\377\266"
+  "\363\376\377\357\374\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\376\377\377\377\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\342\371\376\377"
+  "\237\353\374\377\224\351\374\377\245\354\374\377\254\356\375\377\255"
+  "\356\375\377\253\356\374\377\251\355\374\377\250\355\374\377\247\355"
+  "\374\377\247\355\374\377\246\355\374\377\246\355\374\377\245\354\374"
+  "\377\245\354\374\377\245\355\374\377\246\355\374\377\244\355\374\377"
+  "\231\352\374\377\220\350\374\377\334\370\376\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\331\377\377\377\331\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\331\367\376\377\215\347\373"
+  "\377\222\350\373\377\222\350\373\377\222\350\373\377\222\350\373\377"
+  "\222\350\373\377\222\350\373\377\235\352\374\377\242\353\374\377\241"
+  "\353\374\377\241\353\374\377\241\353\374\377\241\353\374\377\241\353"
+  "\374\377\241\353\374\377\241\353\374\377\241\353\374\377\241\353\374"
+  "\377\241\353\374\377\241\353\374\377\241\353\374\377\241\353\374\377"
+  "\241\353\374\377\241\353\374\377\241\353\374\377\241\353\374\377\242"
+  "\353\374\377\232\351\374\377\236\352\374\377\375\377\377\377\370\376"
+  "\377\377\240\353\374\377\242\354\374\377\243\354\374\377\243\354\374"
+  "\377\243\354\374\377\243\354\374\377\243\354\374\377\243\354\374\377"
+  "\235\353\374\377\356\373\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\261\357\374\377\235\353\374\377\243\354\374"
+  "\377\243\354\374\377\243\354\374\377\243\354\374\377\243\354\374\377"
+  "\244\354\374\377\230\352\374\377\313\364\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\301\362\375\377\232\352\374"
+  "\377\244\354\374\377\243\354\374\377\243\354\374\377\243\354\374\377"
+  "\243\354\374\377\243\354\374\377\235\353\374\377\263\357\374\377\377"
+  "\377\377\377\377\377\377\377\372\376\377\377\243\353\374\377\225\350"
+  "\373\377\243\353\374\377\240\352\374\377\240\352\374\377\241\352\374"
+  "\377\243\353\374\377\224\350\374\377\257\356\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\257\356\374\377\215\347\373\377\221"
+  "\350\373\377\225\350\374\377\245\354\374\377\254\355\374\377\254\355"
+  "\374\377\254\355\374\377\254\355\374\377\254\355\374\377\254\355\374"
+  "\377\254\355\374\377\254\355\374\377\254\355\374\377\254\355\374\377"
+  "\254\355\374\377\254\355\374\377\254\355\374\377\254\355\374\377\254"
+  "\355\374\377\253\355\374\377\241\353\374\377\220\347\373\377\324\366"
+  "\375\377\377\377\377\377\377\377\377\377\261\357\374\377\215\347\373"
+  "\377\221\347\373\377\232\351\374\377\257\356\374\377\265\357\374\377"
+  "\265\357\374\377\265\357\374\377\265\357\374\377\265\357\374\377\265"
+  "\357\374\377\265\357\374\377\265\357\374\377\265\357\374\377\265\357"
+  "\374\377\265\357\374\377\265\357\374\377\265\357\374\377\265\357\374"
+  "\377\265\357\374\377\263\357\374\377\243\353\374\377\215\347\373\377"
+  "\320\365\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\343\372\377\377\244\357\376\377\242\356"
+  "\376\377\255\360\376\377\261\361\376\377\261\361\376\377\260\361\376"
+  "\377\260\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377"
+  "\260\361\376\377\260\361\376\377\260\361\376\377\260\361\376\377\260"
+  "\361\376\377\260\361\376\377\260\361\376\377\261\361\376\377\261\361"
+  "\376\377\256\361\376\377\241\356\376\377\247\357\376\377\346\372\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\332"
+  "\367\376\377\224\351\373\377\231\352\374\377\244\354\374\377\244\354"
+  "\374\377\243\354\374\377\243\354\374\377\243\354\374\377\243\354\374"
+  "\377\243\354\374\377\243\354\374\377\243\354\374\377\244\354\374\377"
+  "\244\354\374\377\244\354\374\377\244\354\374\377\244\354\374\377\244"
+  "\354\374\377\245\354\374\377\240\353\374\377\216\347\373\377\306\363"
+  "\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\352\377\377\377\331\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\330\367\376\377\213\346\373\377\220\347\373\377\220\347\373\377\220"
+  "\347\373\377\220\347\373\377\220\347\373\377\217\347\373\377\225\350"
+  "\374\377\240\352\374\377\237\352\374\377\237\352\374\377\237\352\374"
+  "\377\237\352\374\377\237\352\374\377\237\352\374\377\237\352\374\377"
+  "\237\352\374\377\237\352\374\377\237\352\374\377\237\352\374\377\237"
+  "\352\374\377\237\352\374\377\237\352\374\377\237\352\374\377\237\352"
+  "\374\377\237\352\374\377\237\352\374\377\212\346\373\377\276\361\375"
+  "\377\377\377\377\377\367\375\377\377\237\352\374\377\241\353\374\377"
+  "\242\353\374\377\242\353\374\377\242\353\374\377\242\353\374\377\242"
+  "\353\374\377\242\353\374\377\233\352\374\377\354\373\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\260\356\374\377"
+  "\234\352\374\377\242\353\374\377\242\353\374\377\242\353\374\377\242"
+  "\353\374\377\242\353\374\377\243\353\374\377\227\351\373\377\310\363"
+  "\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\277\361\375\377\231\351\374\377\243\353\374\377\242\353\374\377\242"
+  "\353\374\377\242\353\374\377\242\353\374\377\242\353\374\377\234\352"
+  "\374\377\260\356\374\377\377\377\377\377\377\377\377\377\336\370\376"
+  "\377\217\346\373\377\237\352\374\377\236\352\374\377\236\352\374\377"
+  "\236\352\374\377\236\352\374\377\236\352\374\377\236\352\374\377\220"
+  "\347\373\377\344\371\376\377\377\377\377\377\377\377\377\377\263\357"
+  "\374\377\212\346\373\377\221\347\373\377\235\351\374\377\240\352\374"
+  "\377\236\352\374\377\236\352\374\377\236\352\374\377\236\352\374\377"
+  "\236\352\374\377\236\352\374\377\236\352\374\377\236\352\374\377\236"
+  "\352\374\377\236\352\374\377\236\352\374\377\236\352\374\377\236\352"
+  "\374\377\236\352\374\377\236\352\374\377\236\352\374\377\240\352\374"
+  "\377\232\351\374\377\226\350\373\377\363\374\377\377\377\377\377\377"
+  "\262\356\374\377\212\346\373\377\222\347\373\377\240\352\374\377\241"
+  "\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352"
+  "\374\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352\374"
+  "\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377"
+  "\240\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377\243"
+  "\352\374\377\231\350\374\377\223\347\373\377\361\374\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\355\374\377\377\244\356\375"
+  "\377\241\356\375\377\256\360\375\377\260\360\375\377\257\360\375\377"
+  "\257\360\375\377\257\360\375\377\257\360\375\377\257\360\375\377\260"
+  "\360\375\377\260\360\375\377\257\360\375\377\257\360\375\377\257\360"
+  "\375\377\260\360\375\377\260\360\375\377\257\360\375\377\257\360\375"
+  "\377\257\360\375\377\257\360\375\377\260\360\375\377\256\360\375\377"
+  "\241\356\375\377\244\356\375\377\353\373\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\342\371\376\377\223\350\373\377\232\351\373\377\243\353\374"
+  "\377\242\353\374\377\242\353\374\377\242\353\374\377\242\353\374\377"
+  "\242\353\374\377\242\353\374\377\242\353\374\377\242\353\374\377\242"
+  "\353\374\377\242\353\374\377\242\353\374\377\242\353\374\377\242\353"
+  "\374\377\242\353\374\377\242\353\374\377\242\353\374\377\241\353\374"
+  "\377\216\347\373\377\303\362\375\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\354\377\377\377\331\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\330\366\376\377\211\345\373\377\216\346"
+  "\373\377\216\346\373\377\216\346\373\377\216\346\373\377\216\346\373"
+  "\377\216\346\373\377\215\346\372\377\224\347\373\377\235\351\373\377"
+  "\236\351\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236"
+  "\351\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236\351"
+  "\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236\351\374"
+  "\377\236\351\374\377\236\351\374\377\232\350\373\377\213\345\372\377"
+  "\244\353\374\377\367\375\377\377\377\377\377\377\367\375\377\377\233"
+  "\351\374\377\236\352\374\377\237\352\374\377\237\352\374\377\237\352"
+  "\374\377\237\352\374\377\237\352\374\377\237\352\374\377\225\350\373"
+  "\377\354\373\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\255\355\374\377\230\350\374\377\240\352\374\377\237\352"
+  "\374\377\237\352\374\377\237\352\374\377\237\352\374\377\240\352\374"
+  "\377\220\347\373\377\307\363\375\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\275\361\375\377\224\350\374\377\241\352"
+  "\374\377\237\352\374\377\237\352\374\377\237\352\374\377\237\352\374"
+  "\377\240\352\374\377\226\350\374\377\254\355\374\377\377\377\377\377"
+  "\377\377\377\377\307\363\375\377\215\346\373\377\236\351\374\377\235"
+  "\351\374\377\235\351\374\377\235\351\374\377\235\351\374\377\235\351"
+  "\374\377\236\351\374\377\217\346\373\377\324\366\375\377\377\377\377"
+  "\377\377\377\377\377\270\360\375\377\207\344\373\377\222\347\373\377"
+  "\237\351\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236"
+  "\351\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236\351"
+  "\374\377\236\351\374\377\236\351\374\377\236\351\374\377\236\351\374"
+  "\377\236\351\374\377\236\351\374\377\236\351\374\377\236\351\374\377"
+  "\236\351\374\377\236\351\374\377\237\351\374\377\215\346\372\377\330"
+  "\367\375\377\377\377\377\377\264\356\374\377\207\345\373\377\226\347"
+  "\373\377\236\351\374\377\235\351\374\377\235\351\374\377\235\351\374"
+  "\377\235\351\374\377\235\351\374\377\235\351\374\377\235\351\374\377"
+  "\235\351\374\377\235\351\374\377\235\351\374\377\235\351\374\377\235"
+  "\351\374\377\235\351\374\377\235\351\374\377\235\351\374\377\235\351"
+  "\374\377\235\351\374\377\235\351\374\377\236\351\374\377\213\345\372"
+  "\377\324\366\375\377\377\377\377\377\377\377\377\377\376\377\377\377"
+  "\263\360\376\377\234\354\375\377\253\357\375\377\256\357\375\377\255"
+  "\357\375\377\255\357\375\377\255\357\375\377\255\357\375\377\255\357"
+  "\375\377\255\357\375\377\246\356\375\377\236\355\375\377\234\354\375"
+  "\377\234\354\375\377\235\354\375\377\243\356\375\377\253\357\375\377"
+  "\256\357\375\377\255\357\375\377\255\357\375\377\255\357\375\377\255"
+  "\357\375\377\256\357\375\377\253\357\375\377\234\354\375\377\255\357"
+  "\375\377\371\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\363\374\377\377\234\352\374\377\225\350\374\377"
+  "\241\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377\240"
+  "\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352"
+  "\374\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352\374"
+  "\377\240\352\374\377\240\352\374\377\240\352\374\377\240\352\374\377"
+  "\241\352\374\377\235\351\374\377\210\345\373\377\322\366\375\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\336\377\377"
+  "\377\331\377\377\377\377\377\377\377\377\377\377\377\377\327\366\375"
+  "\377\207\344\372\377\214\345\372\377\214\345\372\377\214\345\372\377"
+  "\214\345\372\377\214\345\372\377\214\345\372\377\214\345\372\377\214"
+  "\345\372\377\214\345\372\377\215\345\372\377\215\345\372\377\215\345"
+  "\372\377\215\345\372\377\215\345\372\377\215\345\372\377\215\345\372"
+  "\377\215\345\372\377\215\345\372\377\215\345\372\377\215\345\372\377"
+  "\215\345\372\377\215\345\372\377\215\345\372\377\214\345\372\377\223"
+  "\347\372\377\272\360\374\377\370\375\377\377\377\377\377\377\377\377"
+  "\377\377\367\375\377\377\227\350\373\377\225\347\373\377\237\351\374"
+  "\377\237\351\374\377\236\351\374\377\237\351\374\377\237\351\374\377"
+  "\226\350\373\377\220\346\373\377\355\373\376\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\253\354\374\377\216\346\373"
+  "\377\236\351\374\377\237\351\374\377\236\351\374\377\236\351\374\377"
+  "\240\351\374\377\233\351\374\377\210\345\373\377\307\362\375\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\274\360\375"
+  "\377\212\345\373\377\234\351\374\377\237\351\374\377\236\351\374\377"
+  "\236\351\374\377\237\351\374\377\235\351\374\377\214\346\373\377\253"
+  "\354\374\377\377\377\377\377\377\377\377\377\304\362\374\377\213\345"
+  "\372\377\235\350\373\377\234\350\373\377\234\350\373\377\234\350\373"
+  "\377\234\350\373\377\234\350\373\377\235\350\373\377\214\345\372\377"
+  "\322\365\375\377\377\377\377\377\377\377\377\377\300\361\374\377\204"
+  "\343\372\377\222\346\373\377\235\350\373\377\234\350\373\377\234\350"
+  "\373\377\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373"
+  "\377\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377"
+  "\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377\234"
+  "\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377\235\350"
+  "\373\377\214\345\372\377\310\363\374\377\377\377\377\377\267\357\374"
+  "\377\205\343\372\377\226\347\373\377\235\350\373\377\234\350\373\377"
+  "\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377\234"
+  "\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377\234\350"
+  "\373\377\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373"
+  "\377\234\350\373\377\234\350\373\377\234\350\373\377\234\350\373\377"
+  "\235\350\373\377\211\344\372\377\303\362\374\377\377\377\377\377\377"
+  "\377\377\377\325\367\376\377\230\353\375\377\246\355\375\377\254\356"
+  "\375\377\253\356\375\377\253\356\375\377\253\356\375\377\253\356\375"
+  "\377\254\356\375\377\252\356\375\377\234\354\375\377\245\356\375\377"
+  "\275\362\376\377\311\365\376\377\313\365\376\377\305\364\376\377\264"
+  "\360\376\377\235\354\375\377\242\355\375\377\254\356\375\377\253\356"
+  "\375\377\253\356\375\377\253\356\375\377\253\356\375\377\254\356\375"
+  "\377\246\355\375\377\227\353\375\377\303\363\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\264\357\374\377\214"
+  "\346\373\377\237\352\374\377\236\352\374\377\236\352\374\377\236\352"
+  "\374\377\236\352\374\377\236\352\374\377\236\352\374\377\237\352\374"
+  "\377\237\352\374\377\237\352\374\377\237\352\374\377\237\352\374\377"
+  "\237\352\374\377\237\352\374\377\237\352\374\377\237\352\374\377\237"
+  "\352\374\377\237\352\374\377\233\351\374\377\212\345\373\377\241\353"
+  "\374\377\370\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\272\377\377\377\331\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\326\366\375\377\205\344\372\377\212\345\372\377\212"
+  "\345\372\377\212\345\372\377\212\345\372\377\212\345\372\377\212\345"
+  "\372\377\212\345\372\377\205\343\372\377\256\354\374\377\342\370\376"
+  "\377\335\367\376\377\335\367\376\377\335\367\376\377\335\367\376\377"
+  "\335\367\376\377\335\367\376\377\335\367\376\377\335\367\376\377\335"
+  "\367\376\377\335\367\376\377\335\367\376\377\335\367\376\377\335\367"
+  "\376\377\336\370\376\377\362\374\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\367\375\377\377\225\350\372\377"
+  "\212\345\372\377\222\346\372\377\230\350\373\377\233\350\373\377\232"
+  "\350\373\377\223\347\372\377\214\345\372\377\217\346\372\377\354\373"
+  "\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\252\354\373\377\207\344\372\377\220\346\372\377\227\350\373\377\233"
+  "\350\373\377\233\350\373\377\225\347\372\377\215\345\372\377\205\344"
+  "\372\377\306\363\375\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\274\360\374\377\205\344\372\377\217\346\372\377\225"
+  "\347\372\377\233\350\373\377\233\350\373\377\227\350\373\377\217\346"
+  "\372\377\207\344\372\377\252\354\373\377\377\377\377\377\377\377\377"
+  "\377\304\362\374\377\205\344\372\377\232\347\373\377\233\350\373\377"
+  "\232\350\373\377\232\350\373\377\232\350\373\377\233\350\373\377\230"
+  "\347\373\377\205\344\372\377\323\365\375\377\377\377\377\377\377\377"
+  "\377\377\307\362\375\377\202\343\372\377\216\346\372\377\233\350\373"
+  "\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377"
+  "\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232"
+  "\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350"
+  "\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373"
+  "\377\232\350\373\377\233\350\373\377\211\344\372\377\324\365\375\377"
+  "\377\377\377\377\273\360\374\377\202\343\372\377\222\346\373\377\233"
+  "\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350"
+  "\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373"
+  "\377\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377"
+  "\232\350\373\377\232\350\373\377\232\350\373\377\232\350\373\377\232"
+  "\350\373\377\232\350\373\377\232\350\373\377\206\344\372\377\320\364"
+  "\375\377\377\377\377\377\375\377\377\377\251\356\375\377\233\353\374"
+  "\377\252\356\374\377\252\355\374\377\252\355\374\377\252\355\374\377"
+  "\252\355\374\377\252\355\374\377\251\356\374\377\235\354\374\377\310"
+  "\364\376\377\370\376\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\350\373\376\377\254\357\375"
+  "\377\235\354\374\377\252\356\374\377\252\356\374\377\252\355\374\377"
+  "\252\355\374\377\252\355\374\377\252\356\374\377\235\354\374\377\236"
+  "\354\374\377\360\374\377\377\377\377\377\377\377\377\377\377\345\371"
+  "\376\377\214\345\372\377\231\350\373\377\236\350\373\377\235\350\373"
+  "\377\235\350\373\377\235\350\373\377\235\350\373\377\235\350\373\377"
+  "\236\351\373\377\234\350\373\377\225\347\373\377\217\346\372\377\216"
+  "\345\372\377\215\345\372\377\215\345\372\377\215\345\372\377\216\345"
+  "\372\377\215\345\372\377\215\345\372\377\212\345\372\377\205\344\372"
+  "\377\240\352\373\377\357\373\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377W\377\377\377\331\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\326\366\375\377\202\343\372"
+  "\377\210\344\372\377\210\344\372\377\210\344\372\377\210\344\372\377"
+  "\210\344\372\377\210\344\372\377\210\344\372\377\201\342\372\377\275"
+  "\360\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\367\375"
+  "\377\377\222\347\372\377\210\345\372\377\212\345\372\377\212\345\372"
+  "\377\214\345\372\377\213\345\372\377\212\345\372\377\211\345\372\377"
+  "\214\345\372\377\354\373\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\250\354\373\377\205\344\372\377\212\345\372"
+  "\377\212\345\372\377\213\345\372\377\213\345\372\377\212\345\372\377"
+  "\212\345\372\377\202\343\372\377\305\362\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\272\360\374\377\203\343\372"
+  "\377\212\345\372\377\212\345\372\377\213\345\372\377\213\345\372\377"
+  "\212\345\372\377\212\345\372\377\205\344\372\377\250\354\373\377\377"
+  "\377\377\377\377\377\377\377\304\362\375\377\200\342\372\377\215\345"
+  "\373\377\227\347\373\377\231\347\373\377\231\347\373\377\231\347\373"
+  "\377\227\346\373\377\214\344\372\377\202\343\372\377\322\365\375\377"
+  "\377\377\377\377\377\377\377\377\315\364\375\377\201\342\372\377\211"
+  "\344\372\377\226\346\373\377\231\347\373\377\230\347\373\377\230\347"
+  "\373\377\230\347\373\377\230\347\373\377\230\347\373\377\230\347\373"
+  "\377\230\347\373\377\230\347\373\377\230\347\373\377\230\347\373\377"
+  "\230\347\373\377\230\347\373\377\230\347\373\377\230\347\373\377\230"
+  "\347\373\377\230\347\373\377\231\347\373\377\223\346\373\377\213\345"
+  "\372\377\356\373\376\377\377\377\377\377\300\361\375\377\200\342\372"
+  "\377\212\344\372\377\230\347\373\377\231\347\373\377\230\347\373\377"
+  "\230\347\373\377\230\347\373\377\230\347\373\377\230\347\373\377\230"
+  "\347\373\377\230\347\373\377\230\347\373\377\230\347\373\377\230\347"
+  "\373\377\230\347\373\377\230\347\373\377\230\347\373\377\230\347\373"
+  "\377\230\347\373\377\230\347\373\377\232\347\373\377\221\345\373\377"
+  "\211\344\372\377\355\373\376\377\377\377\377\377\345\372\376\377\227"
+  "\352\374\377\243\354\374\377\251\355\374\377\250\355\374\377\250\355"
+  "\374\377\250\355\374\377\250\355\374\377\251\355\374\377\232\353\374"
+  "\377\277\362\375\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\360\374\377\377\236\353\374\377\235\353\374\377\250\355"
+  "\374\377\250\355\374\377\250\355\374\377\250\355\374\377\251\355\374"
+  "\377\244\354\374\377\223\351\374\377\312\364\376\377\377\377\377\377"
+  "\377\377\377\377\275\360\374\377\212\344\372\377\234\350\373\377\233"
+  "\350\373\377\233\350\373\377\233\350\373\377\233\350\373\377\233\350"
+  "\373\377\234\350\373\377\225\347\373\377\207\344\372\377\225\347\373"
+  "\377\252\354\373\377\260\355\373\377\257\355\373\377\257\355\373\377"
+  "\257\355\373\377\257\355\373\377\257\355\373\377\256\355\373\377\265"
+  "\356\374\377\325\366\375\377\370\376\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\311\377\377\377"
+  "\011\377\377\377\331\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\325\365\375\377\200\342\371\377\206\343\371\377\206\343\371\377\206"
+  "\343\371\377\206\343\371\377\206\343\371\377\206\343\371\377\206\343"
+  "\371\377\177\341\371\377\273\357\374\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\367\375\377\377\221\346\372\377\207\343\372\377"
+  "\211\344\372\377\210\344\372\377\210\344\372\377\210\344\372\377\211"
+  "\344\372\377\210\344\372\377\213\345\372\377\354\373\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\247\353\373\377"
+  "\204\343\372\377\211\344\372\377\210\344\372\377\210\344\372\377\210"
+  "\344\372\377\211\344\372\377\211\344\372\377\201\342\372\377\304\362"
+  "\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\271\357\374\377\202\342\372\377\211\344\372\377\211\344\372\377\210"
+  "\344\372\377\210\344\372\377\210\344\372\377\211\344\372\377\204\343"
+  "\372\377\247\353\373\377\377\377\377\377\377\377\377\377\303\361\374"
+  "\377~\341\371\377\206\343\371\377\210\343\371\377\216\345\372\377\220"
+  "\345\372\377\216\345\372\377\210\343\371\377\206\343\371\377\200\342"
+  "\371\377\321\364\375\377\377\377\377\377\377\377\377\377\323\365\375"
+  "\377\200\342\371\377\205\343\371\377\211\344\372\377\225\346\372\377"
+  "\230\346\372\377\230\346\372\377\230\346\372\377\230\346\372\377\230"
+  "\346\372\377\230\346\372\377\230\346\372\377\230\346\372\377\230\346"
+  "\372\377\230\346\372\377\230\346\372\377\230\346\372\377\230\346\372"
+  "\377\230\346\372\377\230\346\372\377\230\346\372\377\222\345\372\377"
+  "\200\342\371\377\306\362\375\377\377\377\377\377\377\377\377\377\313"
+  "\363\374\377\177\341\371\377\205\343\371\377\213\344\372\377\226\346"
+  "\372\377\230\346\372\377\230\346\372\377\230\346\372\377\230\346\372"
+  "\377\230\346\372\377\230\346\372\377\230\346\372\377\230\346\372\377"
+  "\230\346\372\377\230\346\372\377\230\346\372\377\230\346\372\377\230"
+  "\346\372\377\230\346\372\377\230\346\372\377\230\346\372\377\220\345"
+  "\372\377~\341\371\377\303\361\374\377\377\377\377\377\377\377\377\377"
+  "\306\363\376\377\222\351\374\377\245\355\374\377\245\355\374\377\245"
+  "\355\374\377\245\355\374\377\245\355\374\377\246\355\374\377\241\354"
+  "\374\377\223\351\374\377\267\360\375\377\325\367\376\377\321\366\376"
+  "\377\321\366\376\377\321\366\376\377\321\366\376\377\321\366\376\377"
+  "\321\366\376\377\321\366\376\377\322\366\376\377\241\354\374\377\225"
+  "\351\374\377\235\353\374\377\246\355\374\377\245\355\374\377\245\355"
+  "\374\377\245\355\374\377\245\355\374\377\224\351\374\377\263\360\375"
+  "\377\377\377\377\377\373\376\377\377\227\347\373\377\221\345\373\377"
+  "\232\347\373\377\231\347\373\377\231\347\373\377\231\347\373\377\231"
+  "\347\373\377\232\347\373\377\223\346\373\377\203\343\372\377\266\356"
+  "\374\377\370\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\363\377\377"
+  "\3779\377\377\377\000\377\377\377\331\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\324\365\375\377~\341\371\377\204\342\371\377\204\342"
+  "\371\377\204\342\371\377\204\342\371\377\204\342\371\377\204\342\371"
+  "\377\204\342\371\377}\340\371\377\272\357\374\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\367\375\377\377\217\345\372\377\205\342"
+  "\372\377\207\343\372\377\207\343\372\377\207\343\372\377\207\343\372"
+  "\377\207\343\372\377\206\343\372\377\211\343\372\377\353\372\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\246\352"
+  "\373\377\201\342\372\377\207\343\372\377\207\343\372\377\207\343\372"
+  "\377\207\343\372\377\207\343\372\377\207\343\372\377\177\341\372\377"
+  "\303\361\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\270\357\374\377\200\341\372\377\207\343\372\377\207\343\372"
+  "\377\207\343\372\377\207\343\372\377\207\343\372\377\207\343\372\377"
+  "\201\342\372\377\246\352\373\377\377\377\377\377\377\377\377\377\302"
+  "\361\374\377|\340\371\377\204\342\371\377\204\342\371\377\203\342\371"
+  "\377\204\342\371\377\204\342\371\377\204\342\371\377\204\342\371\377~"
+  "\341\371\377\320\364\375\377\377\377\377\377\377\377\377\377\334\367"
+  "\375\377\177\341\371\377\204\342\371\377\204\342\371\377\206\342\371"
+  "\377\213\344\371\377\214\344\371\377\214\344\371\377\214\344\371\377"
+  "\214\344\371\377\213\344\371\377\205\342\371\377\205\342\371\377\205"
+  "\342\371\377\205\342\371\377\205\342\371\377\205\342\371\377\205\342"
+  "\371\377\205\342\371\377\205\342\371\377\205\342\371\377\212\344\371"
+  "\377\306\362\375\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\335\367\375\377\200\341\371\377\204\342\371\377\204\342\371\377\207"
+  "\343\371\377\214\344\371\377\214\344\371\377\214\344\371\377\214\344"
+  "\371\377\214\344\371\377\212\343\371\377\205\342\371\377\205\342\371"
+  "\377\205\342\371\377\205\342\371\377\205\342\371\377\205\342\371\377"
+  "\205\342\371\377\205\342\371\377\205\342\371\377\204\342\371\377\212"
+  "\343\371\377\305\362\375\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\267\360\375\377\225\351\374\377\245\354\374\377\244\354\374"
+  "\377\244\354\374\377\244\354\374\377\245\354\374\377\242\354\374\377"
+  "\227\351\374\377\225\351\374\377\223\351\373\377\220\350\373\377\220"
+  "\350\373\377\220\350\373\377\220\350\373\377\220\350\373\377\220\350"
+  "\373\377\220\350\373\377\220\350\373\377\220\350\373\377\224\351\374"
+  "\377\225\351\374\377\225\351\374\377\235\352\374\377\245\354\374\377"
+  "\244\354\374\377\244\354\374\377\245\354\374\377\230\352\374\377\240"
+  "\354\374\377\376\377\377\377\355\373\376\377\212\344\372\377\225\346"
+  "\373\377\227\346\373\377\227\346\373\377\227\346\373\377\227\346\373"
+  "\377\227\346\373\377\226\346\373\377\202\342\371\377\261\355\374\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\366\377\377\377P\377"
+  "\377\377\000\377\377\377\000\377\377\377\331\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\323\365\375\377|\340\371\377\202\341\371\377"
+  "\202\341\371\377\202\341\371\377\202\341\371\377\202\341\371\377\202"
+  "\341\371\377\202\341\371\377z\337\371\377\272\357\374\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\366\375\377\377\216\344\371\377"
+  "\203\341\371\377\205\342\371\377\205\342\371\377\205\342\371\377\205"
+  "\342\371\377\205\342\371\377\204\342\371\377\207\343\371\377\353\372"
+  "\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\244\351\373\377\177\341\371\377\205\342\371\377\205\342\371\377\205"
+  "\342\371\377\205\342\371\377\205\342\371\377\205\342\371\377}\340\371"
+  "\377\302\361\374\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\267\356\374\377~\340\371\377\205\342\371\377\205\342\371"
+  "\377\205\342\371\377\205\342\371\377\205\342\371\377\205\342\371\377"
+  "\177\341\371\377\244\351\373\377\377\377\377\377\377\377\377\377\301"
+  "\361\374\377z\340\371\377\202\342\371\377\202\342\371\377\202\342\371"
+  "\377\202\341\371\377\202\342\371\377\202\342\371\377\202\342\371\377|"
+  "\341\371\377\320\364\375\377\377\377\377\377\377\377\377\377\352\372"
+  "\376\377\203\341\371\377\201\341\371\377\202\341\371\377\202\341\371"
+  "\377\202\341\371\377\201\341\371\377\201\341\371\377\201\341\371\377"
+  "\177\340\371\377\215\344\372\377\306\362\374\377\310\362\374\377\307"
+  "\362\374\377\307\362\374\377\307\362\374\377\307\362\374\377\307\362"
+  "\374\377\307\362\374\377\311\363\374\377\331\366\375\377\360\374\376"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\355\373\376\377\205\342\371\377\200\341\371\377\202\341\371\377\202"
+  "\341\371\377\202\341\371\377\201\341\371\377\201\341\371\377\201\341"
+  "\371\377~\340\371\377\223\345\372\377\312\363\374\377\307\362\374\377"
+  "\307\362\374\377\307\362\374\377\307\362\374\377\307\362\374\377\307"
+  "\362\374\377\307\362\374\377\311\363\374\377\330\366\375\377\361\374"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\255\356\374\377\227\351\373\377\244\353\374\377\242\353\374\377"
+  "\243\353\374\377\243\353\374\377\241\353\374\377\226\351\373\377\222"
+  "\350\373\377\223\350\373\377\223\350\373\377\223\350\373\377\223\350"
+  "\373\377\223\350\373\377\223\350\373\377\223\350\373\377\223\350\373"
+  "\377\223\350\373\377\223\350\373\377\223\350\373\377\223\350\373\377"
+  "\223\350\373\377\223\350\373\377\222\350\373\377\234\352\374\377\243"
+  "\353\374\377\242\353\374\377\243\353\374\377\234\352\374\377\231\351"
+  "\373\377\374\376\377\377\344\371\376\377\206\343\371\377\226\346\372"
+  "\377\226\346\372\377\226\346\372\377\226\346\372\377\226\346\372\377"
+  "\227\346\372\377\216\344\371\377\205\342\371\377\350\372\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\320\377\377\3777\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\326\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\324\365\375\377{\340\371\377\201\341\371\377\201"
+  "\341\371\377\201\341\371\377\201\341\371\377\201\341\371\377\201\341"
+  "\371\377\201\341\371\377z\337\371\377\262\355\373\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\366\375\377\377\214\344\371\377\201"
+  "\341\371\377\203\342\371\377\203\342\371\377\203\342\371\377\203\342"
+  "\371\377\203\342\371\377\202\342\371\377\205\343\371\377\353\372\376"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\243"
+  "\351\373\377}\341\371\377\203\342\371\377\203\342\371\377\203\342\371"
+  "\377\203\342\371\377\203\342\371\377\203\342\371\377{\340\371\377\301"
+  "\361\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\266\356\374\377|\340\371\377\203\342\371\377\203\342\371\377\203"
+  "\342\371\377\203\342\371\377\203\342\371\377\203\342\371\377}\341\371"
+  "\377\243\351\373\377\377\377\377\377\377\377\377\377\300\360\374\377y"
+  "\337\371\377\201\341\371\377\201\341\371\377\201\341\371\377\201\341"
+  "\371\377\201\341\371\377\201\341\371\377\201\341\371\377{\337\371\377"
+  "\317\364\375\377\377\377\377\377\377\377\377\377\372\376\377\377\220"
+  "\345\372\377~\340\371\377\201\341\371\377\201\341\371\377\201\341\371"
+  "\377\201\341\371\377\201\341\371\377\201\341\371\377}\340\371\377\225"
+  "\346\372\377\375\376\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\374\376\377\377\224"
+  "\346\372\377}\340\371\377\201\341\371\377\201\341\371\377\201\341\371"
+  "\377\201\341\371\377\201\341\371\377\201\341\371\377|\340\371\377\235"
+  "\350\372\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\247\354\374\377\226"
+  "\350\374\377\240\352\374\377\240\352\374\377\236\352\374\377\232\351"
+  "\374\377\222\350\373\377\220\347\373\377\221\347\373\377\221\347\373"
+  "\377\221\347\373\377\221\347\373\377\221\347\373\377\221\347\373\377"
+  "\221\347\373\377\221\347\373\377\221\347\373\377\221\347\373\377\221"
+  "\347\373\377\221\347\373\377\221\347\373\377\221\347\373\377\221\347"
+  "\373\377\221\347\373\377\221\347\373\377\233\351\374\377\241\352\374"
+  "\377\241\352\374\377\232\351\374\377\237\352\374\377\377\377\377\377"
+  "\337\370\375\377\203\342\371\377\224\346\372\377\224\346\372\377\224"
+  "\346\372\377\224\346\372\377\224\346\372\377\224\346\372\377\203\342"
+  "\371\377\230\347\372\377\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\376\377\377\377\375\377\377\377\375"
+  "\377\377\377\375\377\377\377\375\377\377\377\375\377\377\377\376\377"
+  "\377\377\370\377\377\377\335\377\377\377\256\377\377\377\134\377\377"
+  "\377\006\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\305\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\330\366\375\377y\337\370\377\177\340\370\377\177\340\370\377\177\340"
+  "\370\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370"
+  "\377z\337\370\377\231\346\371\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\366\375\377\377\212\343\371\377\177\340\371\377\201\341"
+  "\371\377\201\341\371\377\201\341\371\377\201\341\371\377\201\341\371"
+  "\377\200\341\371\377\177\341\371\377\343\370\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\233\347\372\377|\340\371"
+  "\377\201\341\371\377\201\341\371\377\201\341\371\377\201\341\371\377"
+  "\201\341\371\377\201\341\371\377y\337\371\377\275\357\374\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\262\355\374\377z"
+  "\337\371\377\201\341\371\377\201\341\371\377\201\341\371\377\201\341"
+  "\371\377\201\341\371\377\201\341\371\377{\340\371\377\242\351\373\377"
+  "\377\377\377\377\377\377\377\377\277\360\374\377w\336\370\377\177\340"
+  "\370\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370"
+  "\377\177\340\370\377\177\340\370\377y\336\370\377\316\363\374\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\242\351\372\377y\337\370"
+  "\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370\377"
+  "\177\340\370\377\177\340\370\377|\337\370\377\214\343\371\377\370\375"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\245\351\372\377y\336\370"
+  "\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370\377"
+  "\177\340\370\377\177\340\370\377|\337\370\377\213\343\371\377\367\375"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\252\355\374\377\213\346\373\377\221\347"
+  "\373\377\222\347\373\377\220\347\373\377\216\346\373\377\217\346\373"
+  "\377\217\347\373\377\217\347\373\377\217\347\373\377\217\347\373\377"
+  "\217\347\373\377\217\347\373\377\217\347\373\377\217\347\373\377\217"
+  "\347\373\377\217\347\373\377\217\347\373\377\217\347\373\377\217\347"
+  "\373\377\217\347\373\377\217\347\373\377\217\347\373\377\217\347\373"
+  "\377\217\346\373\377\217\346\373\377\231\350\374\377\237\351\374\377"
+  "\215\346\373\377\264\357\374\377\377\377\377\377\336\367\375\377\201"
+  "\341\371\377\222\345\372\377\222\345\372\377\222\345\372\377\222\345"
+  "\372\377\222\345\372\377\221\345\372\377}\340\371\377\234\350\372\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\200\377\377\377\042\377\377\377.\377\377\377.\377\377\377."
+  "\377\377\377.\377\377\377/\377\377\377%\377\377\377\012\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\246\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\345\371\376\377|\337\370\377|\337\370\377"
+  "}\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337"
+  "\370\377|\337\370\377|\337\370\377\331\366\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\370\375\377\377\214\343\371\377|\337\370\377\177\340\370"
+  "\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370\377"
+  "\177\340\370\377x\336\370\377\300\360\374\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\346\371\376\377\202\341\370\377~\340\370\377\177"
+  "\340\370\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340"
+  "\370\377\177\340\370\377y\336\370\377\246\352\372\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\233\347\372\377z\337\370"
+  "\377\177\340\370\377\177\340\370\377\177\340\370\377\177\340\370\377"
+  "\177\340\370\377\177\340\370\377x\336\370\377\255\353\373\377\377\377"
+  "\377\377\377\377\377\377\276\357\374\377u\335\370\377}\337\370\377}"
+  "\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337"
+  "\370\377v\335\370\377\316\363\374\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\261\354\373\377u\335\370\377}\337\370\377}\337\370"
+  "\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377|\337\370\377z"
+  "\337\370\377\333\367\375\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\264"
+  "\355\373\377u\335\370\377}\337\370\377}\337\370\377}\337\370\377}\337"
+  "\370\377}\337\370\377}\337\370\377}\337\370\377y\336\370\377\333\366"
+  "\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\260\355\374\377\207\344\372\377\214\345"
+  "\372\377\214\345\372\377\215\345\372\377\215\345\372\377\215\345\372"
+  "\377\215\345\372\377\215\345\372\377\215\345\372\377\212\345\372\377"
+  "\210\344\372\377\210\344\372\377\210\344\372\377\210\344\372\377\210"
+  "\344\372\377\210\344\372\377\210\344\372\377\210\344\372\377\210\344"
+  "\372\377\210\344\372\377\210\344\372\377\210\344\372\377\210\344\372"
+  "\377\210\344\372\377\207\344\372\377\206\344\372\377\207\344\372\377"
+  "\234\351\373\377\354\373\376\377\377\377\377\377\335\367\375\377\200"
+  "\340\370\377\221\344\371\377\221\344\371\377\221\344\371\377\221\344"
+  "\371\377\221\344\371\377\217\344\371\377{\337\370\377\232\346\371\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377c\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377u\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\372\376\377\377\213\342\371\377w"
+  "\335\370\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377{\336"
+  "\370\377{\336\370\377{\336\370\377w\335\370\377\207\341\371\377\346"
+  "\371\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\375\377\377\377\222\344\371\377y\336\370"
+  "\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377}"
+  "\337\370\377y\336\370\377\216\343\371\377\365\374\376\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\250\352\372\377v\335\370\377}\337\370\377}\337\370"
+  "\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377}\337\370\377|"
+  "\337\370\377|\337\370\377\334\367\375\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\316\363\374\377x\336\370\377}\337\370\377}\337\370\377}\337\370\377}"
+  "\337\370\377}\337\370\377}\337\370\377}\337\370\377u\335\370\377\302"
+  "\360\374\377\377\377\377\377\377\377\377\377\275\357\374\377r\334\370"
+  "\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377{"
+  "\336\370\377{\336\370\377t\334\370\377\315\363\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\312\362\374\377t\334\370\377{\336\370"
+  "\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377{"
+  "\336\370\377u\335\370\377\231\346\372\377\370\375\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\316\363\374\377t\334\370\377{\336\370\377{\336\370\377{\336"
+  "\370\377{\336\370\377{\336\370\377{\336\370\377{\336\370\377v\335\370"
+  "\377\235\347\372\377\367\375\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\270\357\374\377\204\343\372"
+  "\377\213\345\372\377\213\345\372\377\213\345\372\377\213\345\372\377"
+  "\213\345\372\377\213\345\372\377\213\345\372\377\212\345\372\377\237"
+  "\351\373\377\250\353\373\377\246\353\373\377\246\353\373\377\246\353"
+  "\373\377\246\353\373\377\246\353\373\377\246\353\373\377\246\353\373"
+  "\377\246\353\373\377\246\353\373\377\246\353\373\377\247\353\373\377"
+  "\252\354\373\377\253\354\373\377\254\354\373\377\262\356\374\377\316"
+  "\364\375\377\371\375\377\377\377\377\377\377\377\377\377\377\334\367"
+  "\375\377}\337\370\377\217\343\371\377\217\343\371\377\217\343\371\377"
+  "\217\343\371\377\220\343\371\377\214\343\371\377w\336\370\377\230\346"
+  "\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377d\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377<\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\261\354"
+  "\373\377r\334\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370"
+  "\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377u\335\370\377~"
+  "\337\370\377\272\356\374\377\333\366\375\377\343\370\376\377\343\370"
+  "\376\377\343\370\376\377\343\370\376\377\343\370\376\377\343\370\376"
+  "\377\343\370\376\377\343\370\376\377\343\370\376\377\343\370\376\377"
+  "\344\370\376\377\370\375\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\244\351\372\377s\334\370"
+  "\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z"
+  "\336\370\377z\336\370\377t\335\370\377\232\346\372\377\357\373\376\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\372\376\377\377\264"
+  "\355\373\377v\335\370\377z\336\370\377z\336\370\377z\336\370\377z\336"
+  "\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370"
+  "\377v\335\370\377\205\341\371\377\330\366\375\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\320\364\375\377\177\340"
+  "\370\377x\335\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370"
+  "\377z\336\370\377z\336\370\377y\336\370\377v\335\370\377\336\367\375"
+  "\377\377\377\377\377\377\377\377\377\275\357\374\377q\334\370\377z\336"
+  "\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370"
+  "\377z\336\370\377s\334\370\377\315\363\374\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\355\373\376\377~\337\370\377x\336\370\377z"
+  "\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336"
+  "\370\377z\336\370\377t\335\370\377\214\343\371\377\310\361\374\377\337"
+  "\367\375\377\344\370\376\377\343\370\376\377\343\370\376\377\343\370"
+  "\376\377\342\370\376\377\356\373\376\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\357\373\376\377\200\340\370\377x\335\370\377z\336\370\377z\336\370"
+  "\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377s"
+  "\334\370\377\212\342\371\377\307\361\374\377\336\367\375\377\344\370"
+  "\376\377\343\370\376\377\343\370\376\377\343\370\376\377\342\370\376"
+  "\377\356\373\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\315\364\375\377\202\342\372\377\211"
+  "\344\372\377\211\344\372\377\211\344\372\377\211\344\372\377\211\344"
+  "\372\377\211\344\372\377\211\344\372\377\203\343\372\377\307\362\375"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\376\377\377\377\354\373"
+  "\376\377\344\371\376\377\336\367\376\377\360\373\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\334\367\375\377{"
+  "\337\370\377\215\343\371\377\215\343\371\377\215\343\371\377\215\343"
+  "\371\377\216\343\371\377\212\343\371\377v\336\370\377\227\346\371\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377d\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\030\377\377"
+  "\377\354\377\377\377\377\377\377\377\377\377\377\377\377\327\365\375"
+  "\377r\334\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377x"
+  "\335\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377v\335"
+  "\367\377p\333\367\377s\334\367\377v\335\367\377v\335\367\377v\335\367"
+  "\377v\335\367\377v\335\367\377v\335\367\377v\335\367\377v\335\367\377v"
+  "\335\367\377v\335\367\377v\335\367\377\207\341\370\377\270\356\373\377"
+  "\372\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\321"
+  "\364\374\377r\333\367\377y\335\370\377y\335\370\377y\335\370\377y\335"
+  "\370\377y\335\370\377y\335\370\377y\335\370\377y\335\370\377r\334\367"
+  "\377\201\337\370\377\250\351\372\377\265\354\373\377\260\353\373\377"
+  "\215\343\371\377r\334\367\377x\335\370\377y\335\370\377y\335\370\377y"
+  "\335\370\377y\335\370\377y\335\370\377y\335\370\377y\335\370\377y\335"
+  "\370\377y\335\370\377y\335\370\377u\334\370\377v\335\367\377\236\347"
+  "\372\377\264\354\373\377\263\354\373\377\231\345\372\377t\334\367\377w"
+  "\335\370\377y\335\370\377y\335\370\377y\335\370\377y\335\370\377y\335"
+  "\370\377y\335\370\377y\335\370\377v\334\370\377\202\340\370\377\364"
+  "\374\376\377\377\377\377\377\377\377\377\377\274\356\373\377o\333\366"
+  "\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377x"
+  "\335\367\377x\335\367\377q\333\367\377\314\362\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\221\343\371\377s\334"
+  "\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367"
+  "\377x\335\367\377x\335\367\377x\335\367\377t\334\367\377p\333\367\377t"
+  "\335\367\377v\335\367\377v\335\367\377v\335\367\377v\335\367\377u\335"
+  "\367\377}\337\367\377\234\346\372\377\337\367\375\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\223"
+  "\344\371\377r\334\367\377x\335\367\377x\335\367\377x\335\367\377x\335"
+  "\367\377x\335\367\377x\335\367\377x\335\367\377x\335\367\377t\334\367"
+  "\377p\333\367\377t\334\367\377v\335\367\377v\335\367\377v\335\367\377v"
+  "\335\367\377u\335\367\377|\336\367\377\234\346\372\377\336\367\375\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\361\374\376\377\214"
+  "\344\372\377\205\342\372\377\207\343\372\377\207\343\372\377\207\343"
+  "\372\377\207\343\372\377\207\343\372\377\207\343\372\377\205\342\372"
+  "\377\216\345\372\377\334\367\375\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\376\377\377\377\325\365\375\377\255\354"
+  "\373\377\250\353\373\377\260\355\373\377\246\352\373\377\225\346\372"
+  "\377\306\362\374\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\334\366\375\377z\335\370\377\213\341\371\377\213\341\371\377\213\341"
+  "\371\377\213\341\371\377\214\341\371\377\211\341\371\377t\334\370\377"
+  "\225\344\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377d\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\243\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\224\344\371\377o\332\367\377v\334\367\377v\334"
+  "\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367"
+  "\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377u\334\367\377u"
+  "\334\367\377u\334\367\377u\334\367\377u\334\367\377u\334\367\377u\334"
+  "\367\377u\334\367\377u\334\367\377u\334\367\377u\334\367\377r\333\367"
+  "\377l\332\367\377\230\345\371\377\370\375\377\377\377\377\377\377\377"
+  "\377\377\377\364\374\376\377\202\340\370\377s\334\367\377w\335\367\377"
+  "w\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335"
+  "\367\377w\335\367\377t\334\367\377o\333\367\377o\333\367\377o\333\367"
+  "\377r\334\367\377w\335\367\377w\335\367\377w\335\367\377w\335\367\377w"
+  "\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335"
+  "\367\377w\335\367\377w\335\367\377w\335\367\377v\335\367\377p\333\367"
+  "\377o\333\367\377o\333\367\377q\333\367\377w\335\367\377w\335\367\377w"
+  "\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335\367\377w\335"
+  "\367\377w\335\367\377n\333\367\377\270\355\373\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\273\356\373\377m\332\366\377v\334\367\377"
+  "v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334"
+  "\367\377o\332\367\377\313\362\374\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\277\357\373\377n\332\367\377v\334\367"
+  "\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v"
+  "\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377u\334"
+  "\367\377u\334\367\377u\334\367\377u\334\367\377u\334\367\377t\334\367"
+  "\377n\332\367\377w\334\370\377\330\365\375\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\303\360\373\377n\332\367\377v"
+  "\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334"
+  "\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367\377v\334\367"
+  "\377u\334\367\377u\334\367\377u\334\367\377u\334\367\377u\334\367\377t"
+  "\334\367\377n\332\367\377u\334\367\377\325\364\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\254\354\373\377}\341\371\377\204\342"
+  "\371\377\204\342\371\377\204\342\371\377\204\342\371\377\204\342\371"
+  "\377\204\342\371\377\204\342\371\377\201\342\371\377\204\342\371\377"
+  "\240\351\373\377\311\363\374\377\345\371\376\377\354\373\376\377\360"
+  "\374\376\377\356\373\376\377\345\371\376\377\303\361\374\377\227\347"
+  "\372\377\204\342\371\377\221\345\372\377\225\346\372\377\224\346\372"
+  "\377\226\346\372\377\224\345\372\377\210\343\372\377\345\371\376\377"
+  "\377\377\377\377\377\377\377\377\333\366\375\377x\335\367\377\212\341"
+  "\370\377\212\341\370\377\212\341\370\377\212\341\370\377\212\341\370"
+  "\377\210\341\370\377r\334\367\377\223\344\371\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377d\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377J\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\326\365\375\377p\333"
+  "\367\377s\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t"
+  "\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377i\331\367\377\265\354\373"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\306\361\374\377l"
+  "\332\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t"
+  "\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t"
+  "\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377p\333\367\377~\336\370\377\361\373"
+  "\376\377\377\377\377\377\377\377\377\377\377\377\377\377\271\356\373"
+  "\377j\332\366\377s\334\367\377s\334\367\377s\334\367\377s\334\367\377s"
+  "\334\367\377s\334\367\377s\334\367\377l\332\367\377\312\362\374\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\355"
+  "\372\376\377y\335\370\377r\333\367\377t\334\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t"
+  "\334\367\377t\334\367\377t\334\367\377t\334\367\377n\332\367\377\203"
+  "\340\370\377\366\375\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\357\373\376\377{\336\370\377q\333\367\377t\334\367\377t\334"
+  "\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367"
+  "\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377t"
+  "\334\367\377t\334\367\377t\334\367\377t\334\367\377t\334\367\377o\333"
+  "\367\377\200\337\370\377\364\374\376\377\377\377\377\377\377\377\377"
+  "\377\355\373\376\377\206\343\371\377\200\341\371\377\203\342\371\377"
+  "\203\342\371\377\203\342\371\377\203\342\371\377\203\342\371\377\203"
+  "\342\371\377\203\342\371\377\202\341\371\377}\340\371\377|\340\371\377"
+  "\201\341\371\377\205\342\371\377\210\343\371\377\206\342\371\377\201"
+  "\341\371\377|\340\371\377}\340\371\377\215\344\372\377\225\346\372\377"
+  "\223\345\372\377\223\345\372\377\223\345\372\377\224\346\372\377\207"
+  "\343\372\377\300\360\374\377\377\377\377\377\377\377\377\377\332\366"
+  "\375\377v\334\367\377\210\340\370\377\210\340\370\377\210\340\370\377"
+  "\210\340\370\377\210\340\370\377\206\340\370\377p\333\367\377\222\343"
+  "\371\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377d\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\277\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\255\352\373\377h\330\367\377r\333\367\377"
+  "r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333"
+  "\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367"
+  "\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r"
+  "\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333"
+  "\367\377n\332\367\377\204\337\370\377\373\376\377\377\377\377\377\377"
+  "\377\377\377\377\375\377\377\377\225\344\371\377j\331\367\377s\333\367"
+  "\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s"
+  "\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333"
+  "\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367"
+  "\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s"
+  "\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333"
+  "\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377s\333\367"
+  "\377s\333\367\377s\333\367\377s\333\367\377s\333\367\377r\333\367\377j"
+  "\331\367\377\305\361\374\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\270\355\373\377i\331\366\377r\333\367\377r"
+  "\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333"
+  "\367\377k\331\367\377\311\361\374\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\260\353\373\377h\330"
+  "\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367"
+  "\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r"
+  "\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333"
+  "\367\377r\333\367\377r\333\367\377k\331\367\377\324\364\375\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\264\354"
+  "\373\377h\330\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367"
+  "\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r"
+  "\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333\367\377r\333"
+  "\367\377r\333\367\377r\333\367\377r\333\367\377k\331\367\377\317\363"
+  "\374\377\377\377\377\377\377\377\377\377\377\377\377\377\306\361\374"
+  "\377y\337\371\377\200\341\371\377\200\341\371\377\200\341\371\377\200"
+  "\341\371\377\200\341\371\377\200\341\371\377\200\341\371\377\200\341"
+  "\371\377\200\341\371\377\200\341\371\377\200\341\371\377\177\340\371"
+  "\377\177\340\371\377\177\340\371\377\200\341\371\377\200\341\371\377"
+  "\177\341\371\377\214\344\372\377\223\345\372\377\222\345\372\377\222"
+  "\345\372\377\222\345\372\377\223\345\372\377\210\343\371\377\322\364"
+  "\375\377\377\377\377\377\377\377\377\377\332\366\375\377t\333\367\377"
+  "\206\337\370\377\206\337\370\377\206\337\370\377\206\337\370\377\206"
+  "\337\370\377\204\337\370\377n\332\367\377\220\343\371\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377d\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377E\377\377\377\375\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\373\376\377\377\224\344\371\377f\330\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366"
+  "\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377m\331\366"
+  "\377z\335\367\377\365\374\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\352\372\376\377{\335\367\377j\331\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366"
+  "\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366"
+  "\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377f\330\366\377\245\350\372\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\266\354\373\377g\330\365\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377i\330"
+  "\366\377\310\361\374\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\363\374\376\377\202\337\370\377i"
+  "\331\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366"
+  "\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377g\330\365\377\274\356\373\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\365\375\377\377\204"
+  "\340\370\377i\330\366\377p\332\366\377p\332\366\377p\332\366\377p\332"
+  "\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366"
+  "\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p\332\366\377p"
+  "\332\366\377p\332\366\377p\332\366\377f\330\365\377\266\354\373\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\256"
+  "\353\373\377u\335\370\377~\340\370\377~\340\370\377~\340\370\377~\340"
+  "\370\377~\340\370\377~\340\370\377~\340\370\377~\340\370\377~\340\370"
+  "\377~\340\370\377~\340\370\377~\340\370\377~\340\370\377~\340\370\377~"
+  "\340\370\377}\340\370\377\206\342\371\377\222\344\371\377\220\344\371"
+  "\377\220\344\371\377\220\344\371\377\215\343\371\377\230\346\372\377"
+  "\370\375\377\377\377\377\377\377\377\377\377\377\331\366\375\377q\333"
+  "\367\377\205\336\370\377\204\336\370\377\204\336\370\377\204\336\370"
+  "\377\205\336\370\377\202\336\370\377l\332\367\377\216\343\371\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377d\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\226\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\364\374\376\377\217\342\370\377c\327"
+  "\366\377m\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366"
+  "\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n"
+  "\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331"
+  "\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366"
+  "\377k\330\366\377z\335\367\377\367\375\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\334\366\375\377u\333\366\377h"
+  "\330\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o\332"
+  "\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366"
+  "\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377m"
+  "\331\366\377g\330\366\377i\330\366\377o\332\366\377o\332\366\377o\332"
+  "\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366"
+  "\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o\332\366\377o"
+  "\332\366\377o\332\366\377n\332\366\377d\327\366\377\232\345\371\377"
+  "\373\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\301\357\373\377e\327\366\377n\331\366\377"
+  "n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331"
+  "\366\377f\327\366\377\314\362\374\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337"
+  "\367\375\377s\333\366\377g\330\366\377n\331\366\377n\331\366\377n\331"
+  "\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366"
+  "\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n"
+  "\331\366\377n\331\366\377n\331\366\377f\327\366\377\305\360\373\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\342\370\375\377v\334\367\377g\327\366\377n\331\366\377n"
+  "\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331"
+  "\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377n\331\366"
+  "\377n\331\366\377n\331\366\377n\331\366\377n\331\366\377e\327\365\377"
+  "\277\357\373\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\374\376\377\377\251\352\372\377s\335\370\377{\337\370\377"
+  "|\337\370\377|\337\370\377|\337\370\377|\337\370\377|\337\370\377|\337"
+  "\370\377|\337\370\377|\337\370\377|\337\370\377|\337\370\377|\337\370"
+  "\377|\337\370\377|\337\370\377|\337\370\377}\337\370\377\211\342\371"
+  "\377\217\343\371\377\217\343\371\377\214\342\371\377\205\341\370\377"
+  "\326\365\375\377\377\377\377\377\377\377\377\377\377\377\377\377\332"
+  "\365\375\377k\331\366\377\201\336\367\377\203\336\367\377\203\336\367"
+  "\377\203\336\367\377\204\336\367\377\177\335\367\377i\330\366\377\221"
+  "\343\370\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\134\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\016\377\377\377"
+  "\314\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\367\375\376\377\241\347\371\377f\327\366\377h\330\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377e\327\366\377\222\343\370\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\342\367\375\377\177\336\370\377c\326\366\377k\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377f\327\366\377p\332\366\377\301\357\373\377"
+  "\234\345\371\377d\327\366\377j\330\366\377m\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377h\330\366"
+  "\377d\327\366\377\243\347\372\377\373\376\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\344\370\375\377j\331\366\377l\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377j\330\366\377s\332\367"
+  "\377\354\372\376\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\341"
+  "\367\375\377\201\336\367\377c\326\366\377k\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377m\331\366\377k\331\366\377k\330\366\377\345\370\375\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\342\367\375\377\200\336\370\377c\327\366\377k\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377l\331\366\377j\330\366\377\343"
+  "\370\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\376\377\377\377\270\355\373\377u\335\370\377t"
+  "\335\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336"
+  "\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370"
+  "\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377z\336\370\377~"
+  "\337\370\377z\336\370\377\202\340\370\377\317\363\374\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\350\371\376\377l"
+  "\331\366\377t\333\367\377\202\336\367\377\202\336\367\377\201\336\367"
+  "\377\203\336\367\377w\334\367\377b\326\365\377\244\347\372\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377F"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377'\377\377\377\337\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\316\362\374\377~\335\367\377d\327\365\377g\327\366\377l\331\366"
+  "\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377g\330\366"
+  "\377m\331\366\377\336\366\375\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\363\374\376\377\242\347\371\377l\331\366\377d\327\365\377j"
+  "\330\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377l\331\366\377f\327\366\377f\327\365"
+  "\377\215\341\370\377\342\370\375\377\377\377\377\377\376\377\377\377"
+  "\277\356\373\377t\333\367\377c\327\365\377h\330\366\377m\331\366\377m"
+  "\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377l\331\366\377g\327\366\377d\327\365\377{\335\367\377\305\360"
+  "\374\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\246\347\372\377`\326\365\377l\331\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377k\331\366\377b\326\365\377\266\354\372"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\364\374\376\377\245\350\372\377l\331\366\377d\327\365\377"
+  "i\330\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377l\331\366\377a\326\365\377\250\350\372\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\365\375\377\377\250\350\372\377m"
+  "\331\366\377c\327\365\377i\330\366\377m\331\366\377m\331\366\377m\331"
+  "\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366\377m\331\366"
+  "\377m\331\366\377m\331\366\377l\331\366\377a\326\366\377\245\347\372"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\330"
+  "\365\375\377\220\343\371\377r\334\367\377q\334\367\377v\335\367\377x"
+  "\335\367\377x\335\367\377x\335\370\377x\335\370\377x\335\370\377x\335"
+  "\370\377x\335\370\377x\335\367\377x\335\367\377w\335\367\377s\334\367"
+  "\377o\333\367\377u\335\367\377\232\346\372\377\346\371\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\246\350\372\377`\326\365\377t\333\366\377\200\336"
+  "\367\377\201\336\367\377|\335\367\377h\330\366\377o\332\366\377\344"
+  "\370\375\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\346\377\377\377\025\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377+\377\377\377\340\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\370\375\377\377\275\356"
+  "\373\377\216\342\370\377m\331\366\377e\327\366\377d\327\366\377d\327"
+  "\365\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377d\327\365"
+  "\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377d"
+  "\327\365\377c\326\366\377z\334\367\377\326\364\374\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\341\367\375\377\243\347\372\377y\334\367\377f\327\366\377e"
+  "\327\366\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377e\327"
+  "\366\377p\332\366\377\223\343\370\377\313\361\374\377\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\360"
+  "\373\376\377\260\353\372\377\203\337\367\377h\327\366\377e\327\366\377"
+  "d\327\365\377d\327\365\377d\327\365\377d\327\365\377e\327\366\377i\330"
+  "\366\377\207\340\370\377\270\355\373\377\366\375\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\353\377\377\377\367\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\371\376\377\377\247\350\372\377i\330\366\377c\327\365\377"
+  "d\327\365\377c\327\365\377j\330\366\377\260\353\372\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\347"
+  "\377\377\377\225\377\377\377\363\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\342\367\376\377\244\347"
+  "\372\377}\335\367\377g\330\366\377e\327\366\377d\327\365\377d\327\365"
+  "\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377c"
+  "\327\365\377g\330\366\377\246\350\372\377\373\376\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\343\370\376\377\246\350\372\377}\335\367\377g\327\366\377"
+  "e\327\366\377d\327\365\377d\327\365\377d\327\365\377d\327\365\377d\327"
+  "\365\377d\327\365\377d\327\365\377c\327\365\377h\330\366\377\243\347"
+  "\371\377\371\375\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\375\376\377\377\316\363\374\377\234"
+  "\346\371\377z\336\367\377o\333\367\377n\332\366\377m\332\366\377n\332"
+  "\366\377n\332\366\377n\332\366\377m\332\366\377n\332\367\377o\333\367"
+  "\377u\334\367\377\216\343\370\377\256\353\372\377\341\370\375\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\371\375\377"
+  "\377\236\346\371\377e\327\366\377e\327\366\377g\330\366\377c\326\365"
+  "\377x\334\367\377\323\363\374\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\214\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377&"
+  "\377\377\377\317\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\376\377\377\377\344\370"
+  "\375\377\312\361\374\377\274\356\373\377\262\353\372\377\255\352\372"
+  "\377\255\352\372\377\255\352\372\377\255\352\372\377\255\352\372\377"
+  "\255\352\372\377\255\352\372\377\255\352\372\377\255\352\372\377\254"
+  "\352\372\377\260\353\372\377\303\360\374\377\360\373\376\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\352\377\377\377\207\377\377\377\354\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\363"
+  "\374\376\377\322\363\374\377\300\357\373\377\265\354\373\377\255\352"
+  "\372\377\262\353\372\377\274\356\373\377\313\362\374\377\351\371\376"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\372\376\377\377\331\365\375\377\305\360\373\377\270\354"
+  "\373\377\255\352\372\377\257\352\372\377\272\355\373\377\306\360\373"
+  "\377\336\366\375\377\374\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\305\377\377\377\026\377\377\377\214\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\366\375"
+  "\377\270\355\373\377\255\352\372\377\273\355\373\377\337\367\375\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\201\377\377\377\000\377\377\377[\377\377\377"
+  "\370\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\367\375\376\377\327\365\375\377\304"
+  "\360\373\377\271\355\373\377\257\352\372\377\255\352\372\377\255\352"
+  "\372\377\255\352\372\377\255\352\372\377\255\352\372\377\271\355\373"
+  "\377\331\365\375\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\376\377\232\376\376\377]\377\377"
+  "\377\362\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\366\375\376\377\327\364\375\377"
+  "\304\360\373\377\271\355\373\377\257\352\372\377\255\352\372\377\255"
+  "\352\372\377\255\352\372\377\255\352\372\377\255\352\372\377\270\355"
+  "\373\377\333\366\375\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\242\377\377\377\261"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\354\372\376\377\320\363"
+  "\374\377\301\360\373\377\267\355\373\377\261\353\373\377\261\353\373"
+  "\377\263\353\373\377\273\356\373\377\303\360\373\377\317\363\374\377"
+  "\344\370\376\377\375\376\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\376\377\377\377\326\364\375\377\265\354\372\377\256\352\372\377"
+  "\301\357\373\377\356\373\376\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\354\377\377\377'\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\017\377\377\377\241\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377l\377\377\377\000\377\377\3775\377\377\377\325\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\235\377\377\377\014\377\377\377\000\377\377\377\015\377\377\377\310"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\256\377\377\377\001\377\377\377\000\377\377\377\000"
+  "\377\377\377=\377\377\377\333\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\306\377\377\377\021\377\377\377"
+  "\000\377\377\3779\377\377\377\330\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\310\377\377\377\012\377\377"
+  "\377\000\377\377\377\202\377\377\377\372\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\351"
+  "\377\377\377v\377\377\377\306\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377e\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377R\377"
+  "\377\377\324\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377{"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\015\377"
+  "\377\377\212\377\377\377\365\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\372\377\377\377\266\377\377\377\324\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\332\377\377\377V\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\035"
+  "\377\377\377\314\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\264\377\377\377\015\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\021\377\377\377\214\377\377\377\362\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\310\377\377\377\031\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\016\377\377\377\213\377\377\377"
+  "\364\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\314\377\377\377\035\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\3778\377\377\377\276\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\370\377\377\377\243\377\377\377 "
+  "\377\377\377\000\377\377\377#\377\377\377\324\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377}\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\011\377\377\377[\377\377\377\303\377\377\377\376\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\341\377\377\377Q\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377+\377\377\377\222\377\377\377\353\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\370\377\377\377\252\377\377"
+  "\377=\377\377\377\000\377\377\377\014\377\377\377g\377\377\377\322\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\317"
+  "\377\377\377h\377\377\377\020\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\021\377\377\377\227\377\377\377\375\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\370\377\377\377\204\377\377\377\010\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377&\377\377\377\207\377"
+  "\377\377\347\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\374\377\377\377\224\377"
+  "\377\377\016\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377%\377\377\377\205"
+  "\377\377\377\345\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\375\377\377\377\230"
+  "\377\377\377\022\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\003\377\377\377I\377\377\377"
+  "\251\377\377\377\366\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\376\377\377\377\336\377\377\377"
+  "\207\377\377\377/\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\027\377\377\377\244\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\345\377\377\377U\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\004\377\377\377+\377\377\377n\377\377\377"
+  "\266\377\377\377\323\377\377\377\342\377\377\377\351\377\377\377\355"
+  "\377\377\377\355\377\377\377\355\377\377\377\355\377\377\377\355\377"
+  "\377\377\355\377\377\377\355\377\377\377\355\377\377\377\355\377\377"
+  "\377\355\377\377\377\352\377\377\377\340\377\377\377\277\377\377\377b"
+  "\377\377\377\020\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\023\377\377\377H\377\377\377\230"
+  "\377\377\377\312\377\377\377\336\377\377\377\347\377\377\377\354\377"
+  "\377\377\352\377\377\377\341\377\377\377\321\377\377\377\255\377\377"
+  "\377]\377\377\377\037\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\010\377\377\3775\377\377"
+  "\377\200\377\377\377\302\377\377\377\330\377\377\377\345\377\377\377"
+  "\353\377\377\377\353\377\377\377\344\377\377\377\327\377\377\377\276"
+  "\377\377\377|\377\377\3771\377\377\377\007\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377.\377\377\377\217\377\377\377\323\377\377\377\346\377\377\377"
+  "\353\377\377\377\344\377\377\377\321\377\377\377\210\377\377\377#\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\021\377\377\377A\377"
+  "\377\377\211\377\377\377\300\377\377\377\330\377\377\377\345\377\377"
+  "\377\352\377\377\377\355\377\377\377\355\377\377\377\355\377\377\377"
+  "\355\377\377\377\354\377\377\377\345\377\377\377\324\377\377\377\224"
+  "\377\377\377+\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\021\377\377\377>\377"
+  "\377\377\212\377\377\377\303\377\377\377\330\377\377\377\345\377\377"
+  "\377\352\377\377\377\355\377\377\377\355\377\377\377\355\377\377\377"
+  "\355\377\377\377\354\377\377\377\346\377\377\377\323\377\377\377\227"
+  "\377\377\377.\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\034\377\377\377W\377"
+  "\377\377\245\377\377\377\316\377\377\377\337\377\377\377\350\377\377"
+  "\377\355\377\377\377\355\377\377\377\352\377\377\377\346\377\377\377"
+  "\333\377\377\377\315\377\377\377\255\377\377\377h\377\377\3770\377\377"
+  "\377\013\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\001"
+  "\377\377\3779\377\377\377\237\377\377\377\326\377\377\377\350\377\377"
+  "\377\353\377\377\377\343\377\377\377\301\377\377\377i\377\377\377\025"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000"};
+
+
+#ifdef __SUNPRO_C
+#pragma align 4 (home_image)
+#endif
+#ifdef __GNUC__
+static const guint8 home_image[] __attribute__ ((__aligned__ (4))) = 
+#else
+static const guint8 home_image[] = 
+#endif
+{ ""
+  /* Pixbuf magic (0x47646b50) */
+  "GdkP"
+  /* length: header (24) + pixel_data (1024) */
+  "\000\000\004\030"
+  /* pixdata_type (0x1010002) */
+  "\001\001\000\002"
+  /* rowstride (64) */
+  "\000\000\000@"
+  /* width (16) */
+  "\000\000\000\020"
+  /* height (16) */
+  "\000\000\000\020"
+  /* pixel_data: */
+  "\000\000\000\000\000\000\000\000\202\202\202\226\202\202\202\377\202"
+  "\202\202\377\202\202\202\2265\230\317\2265\230\317\3775\230\317\226"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\377\377\377\000\000\000\000\000\000\000"
+  "\000\000\202\202\202\377\356\356\356\377\356\356\356\377U\217\257\3775"
+  "\230\317\377\320\373\377\3775\230\317\3775\230\317\226\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377"
+  "\377\377\000\000\000\000\000\000\000\000\000\202\202\202\377\331\331"
+  "\331\377x\263\323\3775\230\317\377\262\357\377\377\230\345\377\377\262"
+  "\357\377\3775\230\317\3775\230\317\226\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\377\377\377\000\000\000\000\000\000"
+  "\000\000\000\202\202\202\377s\256\316\3775\230\317\377\254\351\377\377"
+  "\217\335\377\377\217\335\377\377\217\335\377\377\254\351\377\3775\230"
+  "\317\3775\230\317\226\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\377\377\377\000\000\000\000\000\000\000\000\000U\217\257\3775\230\317"
+  "\377\243\342\377\377\204\324\377\377\243\342\377\3775\230\317\377\243"
+  "\342\377\377\204\324\377\377\243\342\377\3775\230\317\3775\230\317\226"
+  "\000\000\000\000\000\000\000\000\377\377\377\000\000\000\000\0005\230"
+  "\317\2265\230\317\377\231\332\377\377x\312\372\377\231\332\377\3775"
+  "\230\317\377c\236\276\3775\230\317\377\231\332\377\377x\312\372\377"
+  "\231\332\377\3775\230\317\3775\230\317\226\000\000\000\000\377\377\377"
+  "\0005\230\317\2265\230\317\377\222\322\372\377m\300\363\377\222\322"
+  "\372\3775\230\317\377t\256\317\377\371\371\371\377t\256\317\3775\230"
+  "\317\377\222\322\372\377m\300\363\377\222\322\372\3775\230\317\3775"
+  "\230\317\226\377\377\377\0005\230\317\377\256\337\375\377p\276\357\377"
+  "\211\314\365\3775\230\317\377p\251\312\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377t\256\317\3775\230\317\377\211\314\365\377p\276"
+  "\357\377\256\337\375\3775\230\317\377\377\377\377\0000\216\302\2375"
+  "\230\317\377\251\332\371\3775\230\317\377t\256\317\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377t\256"
+  "\317\3775\230\317\377\251\332\371\3775\230\317\3770\216\302\237\377"
+  "\377\377\000\000\000\000\013(~\256\2555\230\317\377t\256\317\377\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\377t\256\317\3775\230\317\377(~"
+  "\256\255\000\000\000\013\377\377\377\000\000\000\000\000\000\000\000"
+  "\013\207\207\207\377\377\377\377\377\377\377\377\377\377\377\377\377"
+  "\227\227\227\377\227\227\227\377\227\227\227\377\377\377\377\377\377"
+  "\377\377\377\377\377\377\377\207\207\207\377\000\000\000\013\000\000"
+  "\000\000\377\377\377\000\000\000\000\000\000\000\000\000\227\227\227"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\377\227\227\227\377"
+  "\227\227\227\377\227\227\227\377\377\377\377\377\377\377\377\377\377"
+  "\377\377\377\227\227\227\377\000\000\000\000\000\000\000\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\227\227\227\377\377\377\377"
+  "\377\377\377\377\377\377\377\377\377\227\227\227\377\227\227\227\377"
+  "\227\227\227\377\377\377\377\377\377\377\377\377\377\377\377\377\227"
+  "\227\227\377\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\227\227\227\377\377\377\377\377\377\377\377"
+  "\377\377\377\377\377\227\227\227\377\227\227\227\377\227\227\227\377"
+  "\377\377\377\377\377\377\377\377\377\377\377\377\227\227\227\377\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\000\000\000&\000\000\000&"
+  "xxx\241\203\203\203\377\203\203\203\377\203\203\203\377\203\203\203"
+  "\377\203\203\203\377\203\203\203\377\203\203\203\377\203\203\203\377"
+  "\203\203\203\377xxx\241\000\000\000&\000\000\000&\377\377\377\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\032\000\000\000\032\000\000"
+  "\000\032\000\000\000\032\000\000\000\032\000\000\000\032\000\000\000"
+  "\032\000\000\000\032\000\000\000\032\000\000\000\032\000\000\000\032"
+  "\000\000\000\000\000\000\000\000\377\377\377\000"};
+
+
+#ifdef __SUNPRO_C
+#pragma align 4 (reload_image)
+#endif
+#ifdef __GNUC__
+static const guint8 reload_image[] __attribute__ ((__aligned__ (4))) = 
+#else
+static const guint8 reload_image[] = 
+#endif
+{ ""
+  /* Pixbuf magic (0x47646b50) */
+  "GdkP"
+  /* length: header (24) + pixel_data (1024) */
+  "\000\000\004\030"
+  /* pixdata_type (0x1010002) */
+  "\001\001\000\002"
+  /* rowstride (64) */
+  "\000\000\000@"
+  /* width (16) */
+  "\000\000\000\020"
+  /* height (16) */
+  "\000\000\000\020"
+  /* pixel_data: */
+  "\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000%\246\355T%\246\355\275%\246\355\360%\246\355\344%\246\355"
+  "\261%\246\355H\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\377\377\377\000\377\377\377\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000 \236\342Td\317\377\377\261\377\377\377\304\377"
+  "\377\377\276\377\377\377\254\377\377\377Q\302\377\377 \236\342;\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\377\377\377\000\377\377"
+  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000!\237\346\270"
+  "\261\377\377\377\257\377\377\377\227\377\377\377\227\377\377\377\267"
+  "\377\377\377\223\354\377\377 \236\342\222\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\377\377\377\000\377\377\377\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\020{\266[I\276\375\377\266\377\377"
+  "\377\217\375\377\377\221\377\377\377\267\377\377\3775\257\364\377\005a"
+  "\2262\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\000"
+  "\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\014\023\201\276\260\223\354\377\377\247\377\377\377\253\377"
+  "\377\377\207\344\377\377\023\200\276\243\000\000\000\010\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\377\377\377\000\377\377\377\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000P"
+  "\200E8\263\365\377\207\344\377\377\214\346\377\3771\256\362\377\0008`1"
+  "\000\000\000\001\000\000\000\000\000\000\000\000\000\000\000\000\377"
+  "\377\377\000\377\377\377\000\000\000\000\000%\246\355f%\246\355f%\246"
+  "\355f \233\337k\026\207\306\236X\306\377\377V\304\377\377\023\203\277"
+  "\220 \233\337k%\246\355f%\246\355f%\246\355f\000\000\000\000\377\377"
+  "\377\000\377\377\377\000#\243\352\222k\321\377\377k\321\377\377k\321"
+  "\377\377k\321\377\377-\253\361\377\314\377\377\377\301\377\377\377."
+  "\254\362\377k\321\377\377k\321\377\377k\321\377\377k\321\377\377#\243"
+  "\351\217\377\377\377\000\377\377\377\000%\246\355\371\257\374\377\377|"
+  "\342\377\377y\341\377\377\227\361\377\377X\306\377\377V\304\377\377T"
+  "\302\377\377\134\307\377\377\226\357\377\377y\341\377\377|\342\377\377"
+  "\257\374\377\377%\244\354\367\377\377\377\000\377\377\377\000!\237\346"
+  "\330\216\346\377\377X\314\377\377I\306\377\377h\326\377\377\234\354"
+  "\377\377\035\224\326\323\035\224\326\323\234\354\377\377h\326\377\377I"
+  "\306\377\377Y\316\377\377\217\347\377\377!\236\344\326\377\377\377\000"
+  "\377\377\377\000\026\206\304\215q\322\377\377i\322\377\377H\302\377"
+  "\377y\334\377\377K\274\374\377\016x\263o\016x\263oK\274\374\377y\334"
+  "\377\377I\302\377\377k\324\377\377k\316\377\377\023\203\277\202\377"
+  "\377\377\000\377\377\377\000\000(K%(\247\357\377\213\342\377\377p\324"
+  "\377\377\200\332\377\377\026\207\306\275\000\000\000\016\000\000\000"
+  "\016\026\207\306\275\200\332\377\377q\326\377\377\214\342\377\377(\247"
+  "\357\377\000\000\000\031\377\377\377\000\377\377\377\000\000\000\000"
+  "\006\016x\263\2055\257\364\377\223\344\377\3775\257\364\377\003`\223T"
+  "\000\000\000\003\000\000\000\003\003`\223T5\257\364\377\217\344\377"
+  "\3773\256\362\377\020y\263\201\000\000\000\006\377\377\377\000\377\377"
+  "\377\000\000\000\000\000\000\000\000\014\002[\216t\032\214\316\317\003"
+  "a\224q\000\000\000\012\000\000\000\000\000\000\000\000\000\000\000\012"
+  "\003^\221n\032\214\316\314\000Y\213q\000\000\000\014\000\000\000\000"
+  "\377\377\377\000\377\377\377\000\000\000\000\000\000\000\000\001\000"
+  "\000\000\013\000\000\000\023\000\000\000\013\000\000\000\001\000\000"
+  "\000\000\000\000\000\000\000\000\000\001\000\000\000\013\000\000\000"
+  "\022\000\000\000\012\000\000\000\001\000\000\000\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000"};
+
+
+#ifdef __SUNPRO_C
+#pragma align 4 (config_image)
+#endif
+#ifdef __GNUC__
+static const guint8 config_image[] __attribute__ ((__aligned__ (4))) = 
+#else
+static const guint8 config_image[] = 
+#endif
+{ ""
+  /* Pixbuf magic (0x47646b50) */
+  "GdkP"
+  /* length: header (24) + pixel_data (1024) */
+  "\000\000\004\030"
+  /* pixdata_type (0x1010002) */
+  "\001\001\000\002"
+  /* rowstride (64) */
+  "\000\000\000@"
+  /* width (16) */
+  "\000\000\000\020"
+  /* height (16) */
+  "\000\000\000\020"
+  /* pixel_data: */
+  "\000\000\000\000\231\231\231\226\231\231\231\377\231\231\231\226\000"
+  "\000\000\000\377\377\377\000\243\243\243\226\243\243\243\377\243\243"
+  "\243\377\243\243\243\226\000\000\000\000\243\243\243\226\243\243\243"
+  "\377\243\243\243\377\243\243\243\226\377\377\377\000\000\000\000\000"
+  "\231\231\231\377\377\377\377\377\231\231\231\377\000\000\000\000\377"
+  "\377\377\000\243\243\243\377\377\377\377\377\377\377\377\377\243\243"
+  "\243\377\000\000\000\000\243\243\243\377\377\377\377\377\377\377\377"
+  "\377\243\243\243\377\377\377\377\000\000\000\000\000\231\231\231\377"
+  "\377\377\377\377\231\231\231\377\000\000\000\000\377\377\377\000\243"
+  "\243\243\377\377\377\377\377\377\377\377\377\243\243\243\377\000\000"
+  "\000\000\243\243\243\377\377\377\377\377\377\377\377\377\243\243\243"
+  "\377\377\377\377\000\000\000\000\000\231\231\231\377\377\377\377\377"
+  "\231\231\231\377\000\000\000\000\377\377\377\000\243\243\243\377\377"
+  "\377\377\377\377\377\377\377\243\243\243\377\243\243\243\377\243\243"
+  "\243\377\377\377\377\377\377\377\377\377\243\243\243\377\377\377\377"
+  "\000\000\000\000\000\231\231\231\377\377\377\377\377\231\231\231\377"
+  "\000\000\000\000\377\377\377\000\243\243\243\377\377\377\377\377\372"
+  "\372\372\377\377\377\377\377\377\377\377\377\377\377\377\377\372\372"
+  "\372\377\377\377\377\377\243\243\243\377\377\377\377\000\000\000\000"
+  "\000\231\231\231\377\377\377\377\377\231\231\231\377\000\000\000\000"
+  "\377\377\377\000\243\243\243\377\377\377\377\377\377\377\377\377\361"
+  "\361\361\377\353\353\353\377\361\361\361\377\377\377\377\377\377\377"
+  "\377\377\243\243\243\377\377\377\377\000\231\231\231\226\231\231\231"
+  "\377\377\377\377\377\231\231\231\377\231\231\231\226\377\377\377\000"
+  "\220\220\220\244\243\243\243\377\243\243\243\377\372\372\372\377\342"
+  "\342\342\377\372\372\372\377\243\243\243\377\243\243\243\377\220\220"
+  "\220\244\377\377\377\0007\236\327\377\307\377\377\377\217\342\377\377"
+  "\220\321\372\3777\236\327\377\377\377\377\000\000\000\000\013\000\000"
+  "\000\042\243\243\243\377\367\367\367\377\327\327\327\377\367\367\367"
+  "\377\243\243\243\377\000\000\000\042\000\000\000\013\377\377\377\0007"
+  "\236\327\377\266\371\377\377z\331\377\377t\302\362\3777\236\327\377"
+  "\377\377\377\000\000\000\000\000\000\000\000\000\243\243\243\377\361"
+  "\361\361\377\317\317\317\377\361\361\361\377\243\243\243\377\000\000"
+  "\000\000\000\000\000\000\377\377\377\0007\236\327\377\266\371\377\377z"
+  "\331\377\377t\302\362\3777\236\327\377\377\377\377\000\000\000\000\000"
+  "\000\000\000\000\243\243\243\377\353\353\353\377\307\307\307\377\353"
+  "\353\353\377\243\243\243\377\000\000\000\000\000\000\000\000\377\377"
+  "\377\0007\236\327\377\266\371\377\377z\331\377\377t\302\362\3777\236"
+  "\327\377\377\377\377\000\000\000\000\000\000\000\000\000\243\243\243"
+  "\377\345\345\345\377\277\277\277\377\345\345\345\377\243\243\243\377"
+  "\000\000\000\000\000\000\000\000\377\377\377\0007\236\327\377\266\371"
+  "\377\377z\331\377\377t\302\362\3777\236\327\377\377\377\377\000\000"
+  "\000\000\000\000\000\000\000\243\243\243\377\336\336\336\377\267\267"
+  "\267\377\336\336\336\377\243\243\243\377\000\000\000\000\000\000\000"
+  "\000\377\377\377\0007\236\327\377\320\377\377\377\243\353\377\377\236"
+  "\331\374\3777\236\327\377\377\377\377\000\000\000\000\000\000\000\000"
+  "\000\243\243\243\377\373\373\373\377\332\332\332\377\373\373\373\377"
+  "\243\243\243\377\000\000\000\000\000\000\000\000\377\377\377\000/\216"
+  "\302\2447\236\327\3777\236\327\3777\236\327\377/\216\302\244\377\377"
+  "\377\000\000\000\000\000\000\000\000\000\220\220\220\244\243\243\243"
+  "\377\243\243\243\377\243\243\243\377\220\220\220\244\000\000\000\000"
+  "\000\000\000\000\377\377\377\000\000\000\000\013\000\000\000\042\000"
+  "\000\000-\000\000\000\042\000\000\000\013\377\377\377\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\013\000\000\000\042\000\000\000-\000"
+  "\000\000\042\000\000\000\013\000\000\000\000\000\000\000\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"};
+
+
+#ifdef __SUNPRO_C
+#pragma align 4 (post_image)
+#endif
+#ifdef __GNUC__
+static const guint8 post_image[] __attribute__ ((__aligned__ (4))) = 
+#else
+static const guint8 post_image[] = 
+#endif
+{ ""
+  /* Pixbuf magic (0x47646b50) */
+  "GdkP"
+  /* length: header (24) + pixel_data (1024) */
+  "\000\000\004\030"
+  /* pixdata_type (0x1010002) */
+  "\001\001\000\002"
+  /* rowstride (64) */
+  "\000\000\000@"
+  /* width (16) */
+  "\000\000\000\020"
+  /* height (16) */
+  "\000\000\000\020"
+  /* pixel_data: */
+  "\377\377\377\000\000\000\000\000m\277\356um\277\356\336m\277\356\377m"
+  "\277\356\377m\277\356\377m\277\356\377m\277\356\377m\277\356\377m\277"
+  "\356\377m\277\356\377m\277\356\336m\277\356u\000\000\000\000\377\377"
+  "\377\000\377\377\377\000l\275\353[\211\322\362\377\341\373\373\377\341"
+  "\373\373\377\340\373\373\377\340\373\373\377\340\373\373\377\340\373"
+  "\373\377\340\373\373\377\340\373\373\377\341\373\373\377\341\373\373"
+  "\377\211\322\362\377l\275\353[\377\377\377\000\377\377\377\000k\275"
+  "\352\306\324\372\372\377\310\371\371\377\274\367\367\377\273\367\367"
+  "\377\273\367\367\377\273\367\367\377\273\367\367\377\273\367\367\377"
+  "\273\367\367\377\274\367\367\377\310\371\371\377\324\372\372\377k\275"
+  "\352\306\377\377\377\000\377\377\377\000m\277\356\374\333\373\373\377"
+  "\270\367\367\377\265\367\367\377\265\367\367\377\265\367\367\377\265"
+  "\367\367\377\265\367\367\377\265\367\367\377\265\367\367\377\265\367"
+  "\367\377\270\367\367\377\333\373\373\377m\277\356\374\377\377\377\000"
+  "\377\377\377\000m\277\356\377\322\372\372\377\255\366\366\377\255\366"
+  "\366\377\255\366\366\377\255\366\366\377\255\366\366\377\255\366\366"
+  "\377\255\366\366\377\255\366\366\377\255\366\366\377\255\366\366\377"
+  "\322\372\372\377m\277\356\377\377\377\377\000\377\377\377\000m\277\356"
+  "\377\313\371\371\377\246\361\365\377\246\361\365\377\246\361\365\377"
+  "\246\361\365\377\246\361\365\377\246\361\365\377\246\361\365\377\246"
+  "\361\365\377\246\361\365\377\246\361\365\377\313\371\371\377m\277\356"
+  "\377\377\377\377\000\377\377\377\000m\277\356\377\304\370\370\377\234"
+  "\351\364\377\234\351\364\377\234\351\364\377\234\351\364\377\234\351"
+  "\364\377\234\351\364\377\234\351\364\377\234\351\364\377\234\351\364"
+  "\377\234\351\364\377\304\370\370\377m\277\356\377\377\377\377\000\377"
+  "\377\377\000m\277\356\377\301\370\370\377\225\342\363\377\224\341\363"
+  "\377\224\341\363\377\224\341\363\377\224\341\363\377\224\341\363\377"
+  "\224\341\363\377\224\341\363\377\224\341\363\377\225\342\363\377\301"
+  "\370\370\377m\277\356\377\377\377\377\000\377\377\377\000k\274\351\351"
+  "\277\365\370\377\223\335\363\377\213\331\362\377\213\331\362\377\213"
+  "\331\362\377\213\331\362\377\213\331\362\377\213\331\362\377\213\331"
+  "\362\377\213\331\362\377\223\335\363\377\277\365\370\377k\274\351\351"
+  "\377\377\377\000\377\377\377\000`\250\321\223\247\345\365\377\257\353"
+  "\366\377\226\335\363\377\224\334\363\377\233\341\364\377\236\342\364"
+  "\377\236\342\364\377\236\342\364\377\236\342\364\377\237\342\364\377"
+  "\262\355\366\377\247\345\365\377`\250\321\223\377\377\377\000\377\377"
+  "\377\000=k\205+Z\235\303\267\223\330\363\377\252\345\365\377\252\345"
+  "\365\377\227\331\363\377\232\333\364\377\232\333\364\377\232\333\364"
+  "\377\232\333\364\377\232\333\364\377\223\330\363\377Z\235\303\267=k"
+  "\205+\377\377\377\000\377\377\377\000\000\000\000\006\000\000\000\036G"
+  "}\234\204q\303\357\377\254\346\366\377U\226\272\273I\201\240\227I\201"
+  "\240\227I\201\240\227I\201\240\227K\204\244\225I\201\240\201\000\000"
+  "\000\036\000\000\000\006\377\377\377\000\377\377\377\000\000\000\000"
+  "\000\000\000\000\004\000\000\000\020@q\214V\202\314\361\377Ey\227Q\000"
+  "\000\000\022\000\000\000\022\000\000\000\022\000\000\000\022\000\000"
+  "\000\022\000\000\000\014\000\000\000\004\000\000\000\000\377\377\377"
+  "\000\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\001"
+  "\000\000\000\014Q\215\257E\000\000\000\013\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\377\377\377\000\377\377\377\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\002\000\000"
+  "\000\004\000\000\000\002\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+  "\000\000\000\000\377\377\377\000\377\377\377\000\377\377\377\000\377"
+  "\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377"
+  "\377\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377"
+  "\000\377\377\377\000\377\377\377\000\377\377\377\000\377\377\377\000"
+  "\377\377\377\000"};
+
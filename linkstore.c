@@ -0,0 +1,267 @@
+#include <string.h>
+#include "linkstore.h"
+
+typedef struct _LINK_RANGE {
+	int start;		/* offset from the mark of the render */
+	int end;
+	LINK_INFO info;
+} LINK_RANGE;
+
+struct _LINK_RENDER {
+	GtkTextMark* mark;	/* start of the render */
+	int base;		/* offset of the start while rendering */
+	GArray* statuses;	/* int, start of each status from the mark */
+	GArray* links;		/* LINK_RANGE, in order of the text */
+	GStringChunk* strings;	/* payload strings */
+};
+
+struct _LINK_STORE {
+	GtkTextBuffer* buffer;
+	GPtrArray* renders;	/* LINK_RENDER, top to bottom */
+	GSList* dead_marks;	/* deleted after the text */
+	gulong delete_handler;
+	gulong delete_after_handler;
+};
+
+static void link_render_free(LINK_RENDER* render) {
+	g_array_free(render->statuses, TRUE);
+	g_array_free(render->links, TRUE);
+	g_string_chunk_free(render->strings);
+	g_free(render);
+}
+
+static int render_offset(LINK_STORE* store, guint n) {
+	GtkTextIter iter;
+	if (n >= store->renders->len) return gtk_text_buffer_get_char_count(store->buffer);
+	gtk_text_buffer_get_iter_at_mark(store->buffer, &iter, ((LINK_RENDER*)g_ptr_array_index(store->renders, n))->mark);
+	return gtk_text_iter_get_offset(&iter);
+}
+
+/**
+ * index of the last render starting at or before the offset, or -1.
+ */
+static int find_render(LINK_STORE* store, int offset) {
+	int low = 0, high = (int)store->renders->len;
+	while(low < high) {
+		int mid = (low + high) / 2;
+		if (render_offset(store, mid) <= offset) low = mid + 1;
+		else high = mid;
+	}
+	return low - 1;
+}
+
+/**
+ * forget what was in the cut off tail of the render.
+ */
+static void link_render_truncate(LINK_RENDER* render, int cut) {
+	guint len;
+
+	len = render->statuses->len;
+	while(len > 0 && g_array_index(render->statuses, int, len-1) >= cut) len--;
+	g_array_set_size(render->statuses, len);
+	len = render->links->len;
+	while(len > 0 && g_array_index(render->links, LINK_RANGE, len-1).start >= cut) len--;
+	g_array_set_size(render->links, len);
+}
+
+/**
+ * renders in the deleted range are dropped as a whole. their marks go after
+ * the text was deleted, because removing a mark would invalidate the iters
+ * of the deletion.
+ */
+static void link_store_delete_range(GtkTextBuffer* buffer, GtkTextIter* start, GtkTextIter* end, LINK_STORE* store) {
+	int from = gtk_text_iter_get_offset(start);
+	int to = gtk_text_iter_get_offset(end);
+	guint n = 0;
+
+	while(n < store->renders->len) {
+		LINK_RENDER* render = (LINK_RENDER*)g_ptr_array_index(store->renders, n);
+		int base = render_offset(store, n);
+		int limit = render_offset(store, n + 1);
+		if (base >= from && limit <= to) {
+			store->dead_marks = g_slist_prepend(store->dead_marks, render->mark);
+			link_render_free(render);
+			g_ptr_array_remove_index(store->renders, n);
+			continue;
+		}
+		if (base < from && from < limit)
+			link_render_truncate(render, from - base);
+		n++;
+	}
+}
+
+static void link_store_delete_range_after(GtkTextBuffer* buffer, GtkTextIter* start, GtkTextIter* end, LINK_STORE* store) {
+	while(store->dead_marks) {
+		gtk_text_buffer_delete_mark(buffer, (GtkTextMark*)store->dead_marks->data);
+		store->dead_marks = g_slist_delete_link(store->dead_marks, store->dead_marks);
+	}
+}
+
+LINK_STORE* link_store_new(GtkTextBuffer* buffer) {
+	LINK_STORE* store = g_new0(LINK_STORE, 1);
+	store->buffer = buffer;
+	store->renders = g_ptr_array_new();
+	store->delete_handler = g_signal_connect(G_OBJECT(buffer), "delete-range",
+			G_CALLBACK(link_store_delete_range), store);
+	store->delete_after_handler = g_signal_connect_after(G_OBJECT(buffer), "delete-range",
+			G_CALLBACK(link_store_delete_range_after), store);
+	return store;
+}
+
+void link_store_free(LINK_STORE* store) {
+	guint n;
+
+	if (!store) return;
+	g_signal_handler_disconnect(G_OBJECT(store->buffer), store->delete_handler);
+	g_signal_handler_disconnect(G_OBJECT(store->buffer), store->delete_after_handler);
+	for(n = 0; n < store->renders->len; n++) {
+		LINK_RENDER* render = (LINK_RENDER*)g_ptr_array_index(store->renders, n);
+		gtk_text_buffer_delete_mark(store->buffer, render->mark);
+		link_render_free(render);
+	}
+	g_ptr_array_free(store->renders, TRUE);
+	g_free(store);
+}
+
+/**
+ * link under the iter, or NULL.
+ */
+const LINK_INFO* link_store_lookup(LINK_STORE* store, GtkTextIter* iter) {
+	LINK_RENDER* render;
+	int offset = gtk_text_iter_get_offset(iter);
+	int n = find_render(store, offset);
+	int low, high;
+
+	if (n < 0) return NULL;
+	render = (LINK_RENDER*)g_ptr_array_index(store->renders, n);
+	offset -= render_offset(store, n);
+	low = 0;
+	high = (int)render->links->len;
+	while(low < high) {
+		int mid = (low + high) / 2;
+		LINK_RANGE* link = &g_array_index(render->links, LINK_RANGE, mid);
+		if (link->end <= offset) low = mid + 1;
+		else if (link->start > offset) high = mid;
+		else return &link->info;
+	}
+	return NULL;
+}
+
+int link_store_get_length(LINK_STORE* store) {
+	int length = 0;
+	guint n;
+	for(n = 0; n < store->renders->len; n++)
+		length += ((LINK_RENDER*)g_ptr_array_index(store->renders, n))->statuses->len;
+	return length;
+}
+
+/**
+ * iter at the start of the status, counted from the top.
+ */
+gboolean link_store_get_status_iter(LINK_STORE* store, int index, GtkTextIter* iter) {
+	guint n;
+	for(n = 0; n < store->renders->len; n++) {
+		LINK_RENDER* render = (LINK_RENDER*)g_ptr_array_index(store->renders, n);
+		if (index < (int)render->statuses->len) {
+			gtk_text_buffer_get_iter_at_mark(store->buffer, iter, render->mark);
+			gtk_text_iter_forward_chars(iter, g_array_index(render->statuses, int, index));
+			return TRUE;
+		}
+		index -= render->statuses->len;
+	}
+	return FALSE;
+}
+
+/**
+ * let the status start a render of its own, so text can be inserted before
+ * it without moving the offsets of another render.
+ */
+gboolean link_store_split(LINK_STORE* store, int index) {
+	LINK_RENDER* render = NULL;
+	LINK_RENDER* tail;
+	GtkTextIter iter;
+	guint n, link;
+	int cut;
+
+	for(n = 0; n < store->renders->len; n++) {
+		render = (LINK_RENDER*)g_ptr_array_index(store->renders, n);
+		if (index < (int)render->statuses->len) break;
+		index -= render->statuses->len;
+	}
+	if (n == store->renders->len) return FALSE;
+	if (index == 0) return TRUE;
+
+	cut = g_array_index(render->statuses, int, index);
+	tail = link_store_begin(store, 0);
+	for(; index < (int)render->statuses->len; index++) {
+		int offset = g_array_index(render->statuses, int, index) - cut;
+		g_array_append_val(tail->statuses, offset);
+	}
+	for(link = 0; link < render->links->len; link++) {
+		LINK_RANGE* range = &g_array_index(render->links, LINK_RANGE, link);
+		if (range->start < cut) continue;
+		link_render_add(tail, range->start - cut, range->end - cut, range->info.url,
+				range->info.user_id, range->info.user_name, range->info.user_description);
+	}
+	link_render_truncate(render, cut);
+
+	gtk_text_buffer_get_iter_at_mark(store->buffer, &iter, render->mark);
+	gtk_text_iter_forward_chars(&iter, cut);
+	tail->mark = gtk_text_buffer_create_mark(store->buffer, NULL, &iter, FALSE);
+	g_ptr_array_add(store->renders, NULL);
+	memmove(&store->renders->pdata[n+2], &store->renders->pdata[n+1], (store->renders->len - n - 2)*sizeof(gpointer));
+	store->renders->pdata[n+1] = tail;
+	return TRUE;
+}
+
+/**
+ * start a render at the offset. statuses and links are added in order of
+ * the text with absolute offsets, and the render is put in the store by
+ * link_store_commit once all text was inserted.
+ */
+LINK_RENDER* link_store_begin(LINK_STORE* store, int offset) {
+	LINK_RENDER* render = g_new0(LINK_RENDER, 1);
+	render->base = offset;
+	render->statuses = g_array_new(FALSE, FALSE, sizeof(int));
+	render->links = g_array_new(FALSE, FALSE, sizeof(LINK_RANGE));
+	render->strings = g_string_chunk_new(4096);
+	return render;
+}
+
+void link_render_add_status(LINK_RENDER* render, int offset) {
+	offset -= render->base;
+	g_array_append_val(render->statuses, offset);
+}
+
+static const char* link_render_intern(LINK_RENDER* render, const char* str) {
+	return str ? g_string_chunk_insert_const(render->strings, str) : NULL;
+}
+
+void link_render_add(LINK_RENDER* render, int start, int end, const char* url, const char* user_id, const char* user_name, const char* user_description) {
+	LINK_RANGE link;
+	link.start = start - render->base;
+	link.end = end - render->base;
+	link.info.url = url ? g_string_chunk_insert(render->strings, url) : NULL;
+	link.info.user_id = link_render_intern(render, user_id);
+	link.info.user_name = link_render_intern(render, user_name);
+	link.info.user_description = link_render_intern(render, user_description);
+	g_array_append_val(render->links, link);
+}
+
+void link_store_commit(LINK_STORE* store, LINK_RENDER* render) {
+	GtkTextIter iter;
+	GPtrArray* renders = store->renders;
+	int position;
+
+	if (render->statuses->len == 0) {
+		link_render_free(render);
+		return;
+	}
+	/* the mark moves with the text inserted before it later */
+	position = find_render(store, render->base) + 1;
+	gtk_text_buffer_get_iter_at_offset(store->buffer, &iter, render->base);
+	render->mark = gtk_text_buffer_create_mark(store->buffer, NULL, &iter, FALSE);
+	g_ptr_array_add(renders, NULL);
+	memmove(&renders->pdata[position+1], &renders->pdata[position], (renders->len - position - 1)*sizeof(gpointer));
+	renders->pdata[position] = render;
+}
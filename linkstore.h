@@ -0,0 +1,35 @@
+#ifndef _LINKSTORE_H_
+#define _LINKSTORE_H_
+
+#include <gtk/gtk.h>
+
+/**
+ * link payloads of the timeline buffer
+ *
+ * the text carries only shared style tags. where the links go is kept in one
+ * table per render, in offsets from a mark at the start of the render, with
+ * the strings in one chunk. dropped statuses release whole tables at once.
+ */
+typedef struct _LINK_INFO {
+	const char* url;
+	const char* user_id;
+	const char* user_name;
+	const char* user_description;
+} LINK_INFO;
+
+typedef struct _LINK_STORE LINK_STORE;
+typedef struct _LINK_RENDER LINK_RENDER;
+
+LINK_STORE* link_store_new(GtkTextBuffer* buffer);
+void link_store_free(LINK_STORE* store);
+const LINK_INFO* link_store_lookup(LINK_STORE* store, GtkTextIter* iter);
+int link_store_get_length(LINK_STORE* store);
+gboolean link_store_get_status_iter(LINK_STORE* store, int index, GtkTextIter* iter);
+gboolean link_store_split(LINK_STORE* store, int index);
+
+LINK_RENDER* link_store_begin(LINK_STORE* store, int offset);
+void link_render_add_status(LINK_RENDER* render, int offset);
+void link_render_add(LINK_RENDER* render, int start, int end, const char* url, const char* user_id, const char* user_name, const char* user_description);
+void link_store_commit(LINK_STORE* store, LINK_RENDER* render);
+
+#endif /* _LINKSTORE_H_ */
@@ -0,0 +1,266 @@
+#include <stdlib.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "outbox.h"
+
+struct _OUTBOX {
+	char* path;
+	GQueue* items;		/* OUTBOX_ITEM, oldest first */
+	GQueue* rejected;	/* OUTBOX_ITEM not taken yet */
+	gboolean sending;
+	gboolean closing;
+	OUTBOX_SEND_FUNC send_func;
+	OUTBOX_NOTIFY_FUNC notify_func;
+	gpointer user_data;
+	GMutex* lock;
+	GCond* wakeup;
+	GThread* thread;
+};
+
+void outbox_item_free(OUTBOX_ITEM* item) {
+	if (!item) return;
+	g_free(item->account);
+	g_free(item->message);
+	g_free(item->error);
+	g_free(item);
+}
+
+/**
+ * outbox file has one post per line:
+ *   queued \t account \t message
+ * account and message are escaped by g_strescape. failed tries are not
+ * kept, posts are tried at once after a restart.
+ */
+static void outbox_load(OUTBOX* outbox) {
+	gchar* data = NULL;
+	gchar** lines;
+	int n;
+
+	if (!g_file_get_contents(outbox->path, &data, NULL, NULL)) return;
+	lines = g_strsplit(data, "\n", 0);
+	for(n = 0; lines[n]; n++) {
+		gchar** fields = g_strsplit(lines[n], "\t", 3);
+		OUTBOX_ITEM* item;
+		if (g_strv_length(fields) != 3 || !*fields[2]) {
+			g_strfreev(fields);
+			continue;
+		}
+		item = g_new0(OUTBOX_ITEM, 1);
+		item->queued = (time_t)g_ascii_strtoll(fields[0], NULL, 10);
+		item->account = g_strcompress(fields[1]);
+		item->message = g_strcompress(fields[2]);
+		g_queue_push_tail(outbox->items, item);
+		g_strfreev(fields);
+	}
+	g_strfreev(lines);
+	g_free(data);
+}
+
+/**
+ * lock must be held.
+ */
+static gboolean outbox_save(OUTBOX* outbox) {
+	GString* buf = g_string_sized_new(1024);
+	gchar* dir;
+	GList* list;
+	gboolean ret;
+
+	for(list = outbox->items->head; list; list = list->next) {
+		OUTBOX_ITEM* item = (OUTBOX_ITEM*)list->data;
+		gchar* account = g_strescape(item->account, NULL);
+		gchar* message = g_strescape(item->message, NULL);
+		g_string_append_printf(buf, "%ld\t%s\t%s\n", (long)item->queued, account, message);
+		g_free(account);
+		g_free(message);
+	}
+	dir = g_path_get_dirname(outbox->path);
+	g_mkdir_with_parents(dir, 0700);
+	g_free(dir);
+	ret = g_file_set_contents(outbox->path, buf->str, buf->len, NULL);
+	g_string_free(buf, TRUE);
+	return ret;
+}
+
+static time_t outbox_retry_span(int attempts, long retry_after) {
+	long span = OUTBOX_RETRY_MIN_SPAN;
+
+	while(--attempts > 0 && span < OUTBOX_RETRY_MAX_SPAN) span *= 2;
+	if (span > OUTBOX_RETRY_MAX_SPAN) span = OUTBOX_RETRY_MAX_SPAN;
+	if (retry_after > span) span = retry_after;
+	return (time_t)span;
+}
+
+static void outbox_notify(OUTBOX* outbox) {
+	if (outbox->notify_func) outbox->notify_func(outbox, outbox->user_data);
+}
+
+/**
+ * sender. the first post is the only one on the wire, so posts arrive in
+ * the order they were typed. only this thread removes posts from the
+ * queue, so the first one stays while the lock is released to send it.
+ */
+static gpointer outbox_thread(gpointer data) {
+	OUTBOX* outbox = (OUTBOX*)data;
+
+	g_mutex_lock(outbox->lock);
+	while(!outbox->closing) {
+		OUTBOX_ITEM* item = (OUTBOX_ITEM*)g_queue_peek_head(outbox->items);
+		OUTBOX_RESULT result;
+		char* error = NULL;
+		long retry_after = -1;
+		time_t now = time(NULL);
+
+		if (!item) {
+			g_cond_wait(outbox->wakeup, outbox->lock);
+			continue;
+		}
+		if (item->next_try > now) {
+			GTimeVal until;
+			g_get_current_time(&until);
+			until.tv_sec += (glong)(item->next_try - now);
+			g_cond_timed_wait(outbox->wakeup, outbox->lock, &until);
+			continue;
+		}
+
+		outbox->sending = TRUE;
+		g_mutex_unlock(outbox->lock);
+		outbox_notify(outbox);
+		result = outbox->send_func(item, &error, &retry_after, outbox->user_data);
+		g_mutex_lock(outbox->lock);
+		outbox->sending = FALSE;
+
+		g_free(item->error);
+		item->error = error;
+		if (result == OUTBOX_RETRY) {
+			item->attempts++;
+			item->next_try = time(NULL) + outbox_retry_span(item->attempts, retry_after);
+		} else {
+			g_queue_pop_head(outbox->items);
+			if (result == OUTBOX_SENT)
+				outbox_item_free(item);
+			else
+				g_queue_push_tail(outbox->rejected, item);
+			outbox_save(outbox);
+		}
+		g_mutex_unlock(outbox->lock);
+		outbox_notify(outbox);
+		g_mutex_lock(outbox->lock);
+	}
+	g_mutex_unlock(outbox->lock);
+	return NULL;
+}
+
+OUTBOX* outbox_open(const char* path, OUTBOX_SEND_FUNC send_func, OUTBOX_NOTIFY_FUNC notify_func, gpointer user_data) {
+	OUTBOX* outbox = g_new0(OUTBOX, 1);
+
+	outbox->path = g_strdup(path);
+	outbox->items = g_queue_new();
+	outbox->rejected = g_queue_new();
+	outbox->send_func = send_func;
+	outbox->notify_func = notify_func;
+	outbox->user_data = user_data;
+	outbox->lock = g_mutex_new();
+	outbox->wakeup = g_cond_new();
+	outbox_load(outbox);
+	outbox->thread = g_thread_create(outbox_thread, outbox, TRUE, NULL);
+	if (!outbox->thread) {
+		outbox_close(outbox);
+		return NULL;
+	}
+	return outbox;
+}
+
+/**
+ * waits for the post on the wire. posts left are kept for the next run.
+ */
+void outbox_close(OUTBOX* outbox) {
+	OUTBOX_ITEM* item;
+
+	if (!outbox) return;
+	g_mutex_lock(outbox->lock);
+	outbox->closing = TRUE;
+	g_cond_broadcast(outbox->wakeup);
+	g_mutex_unlock(outbox->lock);
+	if (outbox->thread) g_thread_join(outbox->thread);
+
+	outbox_save(outbox);
+	while((item = (OUTBOX_ITEM*)g_queue_pop_head(outbox->items)))
+		outbox_item_free(item);
+	while((item = (OUTBOX_ITEM*)g_queue_pop_head(outbox->rejected)))
+		outbox_item_free(item);
+	g_queue_free(outbox->items);
+	g_queue_free(outbox->rejected);
+	g_cond_free(outbox->wakeup);
+	g_mutex_free(outbox->lock);
+	g_free(outbox->path);
+	g_free(outbox);
+}
+
+/**
+ * queue a post. the same message typed again by the same account while
+ * the first one is waiting is taken as one, and FALSE is returned.
+ */
+gboolean outbox_push(OUTBOX* outbox, const char* account, const char* message) {
+	OUTBOX_ITEM* item;
+	OUTBOX_ITEM* last;
+	gboolean ret = FALSE;
+
+	g_mutex_lock(outbox->lock);
+	last = (OUTBOX_ITEM*)g_queue_peek_tail(outbox->items);
+	if (!last || strcmp(last->account, account) || strcmp(last->message, message)) {
+		item = g_new0(OUTBOX_ITEM, 1);
+		item->account = g_strdup(account);
+		item->message = g_strdup(message);
+		item->queued = time(NULL);
+		g_queue_push_tail(outbox->items, item);
+		outbox_save(outbox);
+		g_cond_broadcast(outbox->wakeup);
+		ret = TRUE;
+	}
+	g_mutex_unlock(outbox->lock);
+	if (ret) outbox_notify(outbox);
+	return ret;
+}
+
+/**
+ * try the waiting posts now. ex: the account was changed.
+ */
+void outbox_kick(OUTBOX* outbox) {
+	GList* list;
+
+	g_mutex_lock(outbox->lock);
+	for(list = outbox->items->head; list; list = list->next)
+		((OUTBOX_ITEM*)list->data)->next_try = 0;
+	g_cond_broadcast(outbox->wakeup);
+	g_mutex_unlock(outbox->lock);
+}
+
+void outbox_get_status(OUTBOX* outbox, OUTBOX_STATUS* status) {
+	OUTBOX_ITEM* item;
+
+	memset(status, 0, sizeof(OUTBOX_STATUS));
+	g_mutex_lock(outbox->lock);
+	status->length = (int)g_queue_get_length(outbox->items);
+	status->sending = outbox->sending;
+	item = (OUTBOX_ITEM*)g_queue_peek_head(outbox->items);
+	if (item) {
+		status->next_try = item->next_try;
+		status->attempts = item->attempts;
+		status->error = g_strdup(item->error);
+	}
+	g_mutex_unlock(outbox->lock);
+}
+
+void outbox_status_clear(OUTBOX_STATUS* status) {
+	g_free(status->error);
+	status->error = NULL;
+}
+
+OUTBOX_ITEM* outbox_take_rejected(OUTBOX* outbox) {
+	OUTBOX_ITEM* item;
+
+	g_mutex_lock(outbox->lock);
+	item = (OUTBOX_ITEM*)g_queue_pop_head(outbox->rejected);
+	g_mutex_unlock(outbox->lock);
+	return item;
+}
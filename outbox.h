@@ -0,0 +1,59 @@
+#ifndef _OUTBOX_H_
+#define _OUTBOX_H_
+
+#include <time.h>
+#include <glib.h>
+
+#define OUTBOX_RETRY_MIN_SPAN  5
+#define OUTBOX_RETRY_MAX_SPAN  (10*60)
+
+/**
+ * outbox of posts
+ *
+ * posts are queued at once and kept in a file, so they survive a restart.
+ * one sender thread hands them to send_func in the order they were queued.
+ * a post which failed for the moment is tried again later, the wait doubles
+ * from OUTBOX_RETRY_MIN_SPAN up to OUTBOX_RETRY_MAX_SPAN seconds. a post
+ * which was refused is dropped from the queue and can be taken back with
+ * outbox_take_rejected. notify_func is called from the sender thread
+ * whenever the queue was changed.
+ */
+typedef struct _OUTBOX OUTBOX;
+
+typedef struct _OUTBOX_ITEM {
+	char* account;		/* who posts it */
+	char* message;		/* as typed */
+	time_t queued;		/* when it was typed */
+	int attempts;		/* failed tries */
+	time_t next_try;	/* not tried before */
+	char* error;		/* last error, or NULL */
+} OUTBOX_ITEM;
+
+typedef enum {
+	OUTBOX_SENT,
+	OUTBOX_RETRY,		/* failed for the moment */
+	OUTBOX_REJECTED		/* never be accepted */
+} OUTBOX_RESULT;
+
+/* error is set to a g_malloc'ed string, retry_after to seconds or -1 */
+typedef OUTBOX_RESULT (*OUTBOX_SEND_FUNC)(OUTBOX_ITEM* item, char** error, long* retry_after, gpointer user_data);
+typedef void (*OUTBOX_NOTIFY_FUNC)(OUTBOX* outbox, gpointer user_data);
+
+typedef struct _OUTBOX_STATUS {
+	int length;		/* posts waiting, the one on the wire included */
+	gboolean sending;	/* first post is on the wire */
+	time_t next_try;	/* first post is not tried before */
+	int attempts;		/* failed tries of the first post */
+	char* error;		/* last error of the first post, or NULL */
+} OUTBOX_STATUS;
+
+OUTBOX* outbox_open(const char* path, OUTBOX_SEND_FUNC send_func, OUTBOX_NOTIFY_FUNC notify_func, gpointer user_data);
+void outbox_close(OUTBOX* outbox);
+gboolean outbox_push(OUTBOX* outbox, const char* account, const char* message);
+void outbox_kick(OUTBOX* outbox);
+void outbox_get_status(OUTBOX* outbox, OUTBOX_STATUS* status);
+void outbox_status_clear(OUTBOX_STATUS* status);
+OUTBOX_ITEM* outbox_take_rejected(OUTBOX* outbox);
+void outbox_item_free(OUTBOX_ITEM* item);
+
+#endif /* _OUTBOX_H_ */
@@ -0,0 +1,276 @@
+#include <string.h>
+#include <libxml/parser.h>
+#include <libxml/dict.h>
+#include "status.h"
+
+enum {
+	FIELD_STATUS_ID,
+	FIELD_DATE,
+	FIELD_TEXT,
+	FIELD_USER_ID,
+	FIELD_USER_REAL,
+	FIELD_USER_NAME,
+	FIELD_USER_ICON,
+	FIELD_USER_DESC,
+	FIELD_MAX
+};
+
+/* element names, interned in the dictionary of the parser */
+enum {
+	ELEMENT_STATUSES,
+	ELEMENT_STATUS,
+	ELEMENT_USER,
+	ELEMENT_ID,
+	ELEMENT_CREATED_AT,
+	ELEMENT_TEXT,
+	ELEMENT_NAME,
+	ELEMENT_SCREEN_NAME,
+	ELEMENT_PROFILE_IMAGE_URL,
+	ELEMENT_DESCRIPTION,
+	ELEMENT_MAX
+};
+
+static const char* element_names[ELEMENT_MAX] = {
+	"statuses",
+	"status",
+	"user",
+	"id",
+	"created_at",
+	"text",
+	"name",
+	"screen_name",
+	"profile_image_url",
+	"description",
+};
+
+struct _STATUS_PARSER {
+	xmlParserCtxtPtr ctxt;
+	const xmlChar* names[ELEMENT_MAX];
+	STATUS_FUNC func;
+	gpointer user_data;
+	int depth;
+	gboolean is_timeline;	/* root element is <statuses> */
+	gboolean in_status;
+	gboolean in_user;
+	int field;		/* field being captured, or -1 */
+	GString* fields[FIELD_MAX];
+	gboolean has_field[FIELD_MAX];
+	int count;
+	gboolean failed;
+};
+
+void status_info_free(STATUS_INFO* info) {
+	free(info);
+}
+
+/**
+ * copy of a record whose strings live elsewhere, in one block.
+ */
+STATUS_INFO* status_info_dup(const STATUS_INFO* src) {
+	STATUS_INFO* info;
+	const char* values[FIELD_MAX];
+	char** dest[FIELD_MAX];
+	char* ptr;
+	size_t size = sizeof(STATUS_INFO);
+	int n;
+
+	values[FIELD_STATUS_ID] = src->status_id;
+	values[FIELD_DATE] = src->date;
+	values[FIELD_TEXT] = src->text;
+	values[FIELD_USER_ID] = src->id;
+	values[FIELD_USER_REAL] = src->real;
+	values[FIELD_USER_NAME] = src->name;
+	values[FIELD_USER_ICON] = src->icon;
+	values[FIELD_USER_DESC] = src->desc;
+	for(n = 0; n < FIELD_MAX; n++)
+		if (values[n]) size += strlen(values[n]) + 1;
+	info = malloc(size);
+	if (!info) return NULL;
+	memset(info, 0, sizeof(STATUS_INFO));
+
+	dest[FIELD_STATUS_ID] = &info->status_id;
+	dest[FIELD_DATE] = &info->date;
+	dest[FIELD_TEXT] = &info->text;
+	dest[FIELD_USER_ID] = &info->id;
+	dest[FIELD_USER_REAL] = &info->real;
+	dest[FIELD_USER_NAME] = &info->name;
+	dest[FIELD_USER_ICON] = &info->icon;
+	dest[FIELD_USER_DESC] = &info->desc;
+
+	ptr = (char*)(info + 1);
+	for(n = 0; n < FIELD_MAX; n++) {
+		if (!values[n]) continue;
+		strcpy(ptr, values[n]);
+		*dest[n] = ptr;
+		ptr += strlen(ptr) + 1;
+	}
+	return info;
+}
+
+/**
+ * pack the captured fields into one block.
+ */
+static STATUS_INFO* make_status_info(STATUS_PARSER* parser) {
+	STATUS_INFO* info;
+	char** dest[FIELD_MAX];
+	char* ptr;
+	size_t size = sizeof(STATUS_INFO);
+	int n;
+
+	for(n = 0; n < FIELD_MAX; n++)
+		if (parser->has_field[n]) size += parser->fields[n]->len + 1;
+	info = malloc(size);
+	if (!info) return NULL;
+	memset(info, 0, sizeof(STATUS_INFO));
+
+	dest[FIELD_STATUS_ID] = &info->status_id;
+	dest[FIELD_DATE] = &info->date;
+	dest[FIELD_TEXT] = &info->text;
+	dest[FIELD_USER_ID] = &info->id;
+	dest[FIELD_USER_REAL] = &info->real;
+	dest[FIELD_USER_NAME] = &info->name;
+	dest[FIELD_USER_ICON] = &info->icon;
+	dest[FIELD_USER_DESC] = &info->desc;
+
+	ptr = (char*)(info + 1);
+	for(n = 0; n < FIELD_MAX; n++) {
+		if (!parser->has_field[n]) continue;
+		memcpy(ptr, parser->fields[n]->str, parser->fields[n]->len + 1);
+		*dest[n] = ptr;
+		ptr += parser->fields[n]->len + 1;
+	}
+	if (info->icon) {
+		info->icon = g_strchomp(info->icon);
+		info->icon = g_strchug(info->icon);
+	}
+	return info;
+}
+
+static void status_start_element(void* ctx, const xmlChar* localname, const xmlChar* prefix, const xmlChar* URI,
+		int nb_namespaces, const xmlChar** namespaces, int nb_attributes, int nb_defaulted, const xmlChar** attributes) {
+	STATUS_PARSER* parser = (STATUS_PARSER*)ctx;
+	const xmlChar** names = parser->names;
+	int depth = parser->depth++;
+	int n;
+
+	if (depth == 0) {
+		parser->is_timeline = (localname == names[ELEMENT_STATUSES]);
+		if (localname != names[ELEMENT_STATUS]) return;
+		/* one status as answered to an update, taken as a timeline of one */
+		parser->is_timeline = TRUE;
+		parser->depth++;
+		depth = 1;
+	}
+	if (!parser->is_timeline) return;
+
+	if (depth == 1) {
+		if (localname != names[ELEMENT_STATUS]) return;
+		parser->in_status = TRUE;
+		for(n = 0; n < FIELD_MAX; n++) {
+			g_string_truncate(parser->fields[n], 0);
+			parser->has_field[n] = FALSE;
+		}
+	} else
+	if (depth == 2 && parser->in_status) {
+		if (localname == names[ELEMENT_ID]) parser->field = FIELD_STATUS_ID;
+		else if (localname == names[ELEMENT_CREATED_AT]) parser->field = FIELD_DATE;
+		else if (localname == names[ELEMENT_TEXT]) parser->field = FIELD_TEXT;
+		else if (localname == names[ELEMENT_USER]) parser->in_user = TRUE;
+	} else
+	if (depth == 3 && parser->in_user) {
+		if (localname == names[ELEMENT_ID]) parser->field = FIELD_USER_ID;
+		else if (localname == names[ELEMENT_NAME]) parser->field = FIELD_USER_REAL;
+		else if (localname == names[ELEMENT_SCREEN_NAME]) parser->field = FIELD_USER_NAME;
+		else if (localname == names[ELEMENT_PROFILE_IMAGE_URL]) parser->field = FIELD_USER_ICON;
+		else if (localname == names[ELEMENT_DESCRIPTION]) parser->field = FIELD_USER_DESC;
+	}
+	if (parser->field >= 0) parser->has_field[parser->field] = TRUE;
+}
+
+static void status_end_element(void* ctx, const xmlChar* localname, const xmlChar* prefix, const xmlChar* URI) {
+	STATUS_PARSER* parser = (STATUS_PARSER*)ctx;
+	int depth = --parser->depth;
+
+	if (!parser->is_timeline) return;
+	parser->field = -1;
+	if (depth == 2 && parser->in_user)
+		parser->in_user = FALSE;
+	else
+	if (depth == 1 && parser->in_status) {
+		STATUS_INFO* info;
+		parser->in_status = FALSE;
+		if (!parser->has_field[FIELD_USER_NAME]) return;
+		info = make_status_info(parser);
+		if (!info) return;
+		parser->count++;
+		parser->func(info, parser->user_data);
+	}
+}
+
+static void status_characters(void* ctx, const xmlChar* ch, int len) {
+	STATUS_PARSER* parser = (STATUS_PARSER*)ctx;
+	if (parser->field < 0) return;
+	g_string_append_len(parser->fields[parser->field], (const char*)ch, len);
+}
+
+static void status_error(void* ctx, xmlErrorPtr error) {
+	/* errors are reported by the return value of xmlParseChunk */
+}
+
+STATUS_PARSER* status_parser_new(STATUS_FUNC func, gpointer user_data) {
+	STATUS_PARSER* parser;
+	xmlSAXHandler sax;
+	int n;
+
+	memset(&sax, 0, sizeof(sax));
+	sax.initialized = XML_SAX2_MAGIC;
+	sax.startElementNs = status_start_element;
+	sax.endElementNs = status_end_element;
+	sax.characters = status_characters;
+	sax.cdataBlock = status_characters;
+	sax.serror = status_error;
+
+	parser = malloc(sizeof(STATUS_PARSER));
+	memset(parser, 0, sizeof(STATUS_PARSER));
+	parser->func = func;
+	parser->user_data = user_data;
+	parser->field = -1;
+	parser->ctxt = xmlCreatePushParserCtxt(&sax, parser, NULL, 0, NULL);
+	if (!parser->ctxt) {
+		free(parser);
+		return NULL;
+	}
+	xmlCtxtUseOptions(parser->ctxt, XML_PARSE_NONET | XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+	for(n = 0; n < ELEMENT_MAX; n++)
+		parser->names[n] = xmlDictLookup(parser->ctxt->dict, (const xmlChar*)element_names[n], -1);
+	for(n = 0; n < FIELD_MAX; n++)
+		parser->fields[n] = g_string_sized_new(64);
+	return parser;
+}
+
+gboolean status_parser_feed(STATUS_PARSER* parser, const char* data, size_t size) {
+	if (parser->failed) return FALSE;
+	if (xmlParseChunk(parser->ctxt, data, (int)size, 0) != 0)
+		parser->failed = TRUE;
+	return !parser->failed;
+}
+
+/**
+ * returns the number of statuses, or -1 if the document was not a timeline.
+ */
+int status_parser_finish(STATUS_PARSER* parser) {
+	if (!parser->failed && xmlParseChunk(parser->ctxt, NULL, 0, 1) != 0)
+		parser->failed = TRUE;
+	if (parser->failed || !parser->is_timeline) return -1;
+	return parser->count;
+}
+
+void status_parser_free(STATUS_PARSER* parser) {
+	int n;
+
+	if (!parser) return;
+	for(n = 0; n < FIELD_MAX; n++)
+		g_string_free(parser->fields[n], TRUE);
+	xmlFreeParserCtxt(parser->ctxt);
+	free(parser);
+}
@@ -0,0 +1,41 @@
+#ifndef _STATUS_H_
+#define _STATUS_H_
+
+#include <glib.h>
+
+/**
+ * status record
+ *
+ * one allocation holds the record and all of its strings. release it with
+ * status_info_free().
+ */
+typedef struct _STATUS_INFO {
+	char* status_id;
+	char* date;
+	char* text;
+	char* id;		/* user id */
+	char* real;		/* user name */
+	char* name;		/* screen name */
+	char* icon;		/* profile image url */
+	char* desc;		/* user description */
+} STATUS_INFO;
+
+STATUS_INFO* status_info_dup(const STATUS_INFO* src);
+void status_info_free(STATUS_INFO* info);
+
+/**
+ * streaming timeline parser
+ *
+ * statuses xml is pushed in chunks as it arrives. the callback gets each
+ * record as soon as its </status> is closed and owns it from then on. a
+ * single <status> document is taken as a timeline of one.
+ */
+typedef void (*STATUS_FUNC)(STATUS_INFO* info, gpointer user_data);
+typedef struct _STATUS_PARSER STATUS_PARSER;
+
+STATUS_PARSER* status_parser_new(STATUS_FUNC func, gpointer user_data);
+gboolean status_parser_feed(STATUS_PARSER* parser, const char* data, size_t size);
+int status_parser_finish(STATUS_PARSER* parser);
+void status_parser_free(STATUS_PARSER* parser);
+
+#endif /* _STATUS_H_ */
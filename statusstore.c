@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "statusstore.h"
+
+#define STORE_MAGIC      "GTSTORE1"
+#define STORE_MAGIC_SIZE 8
+#define STORE_DELTA_MAX  16	/* deltas on a timeline before it is written whole */
+
+/**
+ * log file is the magic followed by records:
+ *   size (4 bytes, host order) kind (1 byte) fields (NUL terminated)
+ * size counts the kind and the fields. kinds are:
+ *   'S' status_id date text user_id
+ *   'U' user_id real name icon desc
+ *   'T' key status_id...
+ *   'D' key previous status_id...
+ * later records of the same id win. empty fields stand for NULL. a 'D'
+ * record puts the statuses new to a timeline on top of the 'T' or 'D'
+ * record of the timeline at offset previous, so a poll does not write the
+ * whole timeline again.
+ */
+#define RECORD_STATUS   'S'
+#define RECORD_USER     'U'
+#define RECORD_TIMELINE 'T'
+#define RECORD_DELTA    'D'
+
+struct _STATUS_STORE {
+	char* path;
+	size_t max_size;
+	size_t compact_size;	/* log is rewritten when it grows over this */
+	GMappedFile* map;
+	const char* base;	/* records of the last run */
+	size_t mapped;		/* valid bytes of base */
+	GString* tail;		/* records appended after base */
+	FILE* fp;
+	GHashTable* statuses;	/* status id -> offset */
+	GHashTable* users;	/* user id -> offset */
+	GHashTable* timelines;	/* key -> offset */
+	GMutex* lock;
+};
+
+static void store_load(STATUS_STORE* store);
+
+/**
+ * record at the offset, starting at its kind.
+ */
+static const char* store_record(STATUS_STORE* store, gsize offset, guint32* size) {
+	const char* ptr;
+	if (offset < store->mapped)
+		ptr = store->base + offset;
+	else
+		ptr = store->tail->str + (offset - store->mapped);
+	memcpy(size, ptr, 4);
+	return ptr + 4;
+}
+
+static int record_fields(const char* record, guint32 size, const char** fields, int max) {
+	const char* end = record + size;
+	const char* ptr = record + 1;
+	int count = 0;
+
+	while(ptr < end && count < max) {
+		fields[count++] = ptr;
+		ptr += strlen(ptr) + 1;
+	}
+	return count;
+}
+
+static const char* or_null(const char* str) {
+	return (str && *str) ? str : NULL;
+}
+
+static void store_index(STATUS_STORE* store, gsize offset, const char* record) {
+	GHashTable* table;
+
+	switch(*record) {
+	case RECORD_STATUS: table = store->statuses; break;
+	case RECORD_USER: table = store->users; break;
+	case RECORD_TIMELINE: table = store->timelines; break;
+	case RECORD_DELTA: table = store->timelines; break;
+	default: return;
+	}
+	g_hash_table_replace(table, g_strdup(record + 1), GSIZE_TO_POINTER(offset));
+}
+
+/**
+ * index the records of a log. returns the end of the last whole record.
+ */
+static size_t store_scan(STATUS_STORE* store, const char* data, size_t len) {
+	size_t offset = STORE_MAGIC_SIZE;
+
+	while(offset + 4 < len) {
+		guint32 size;
+		memcpy(&size, data + offset, 4);
+		if (size < 1 || offset + 4 + size > len || data[offset + 4 + size - 1] != 0) break;
+		store_index(store, offset, data + offset + 4);
+		offset += 4 + size;
+	}
+	return offset;
+}
+
+static void format_record(GString* record, char kind, const char** fields, int count) {
+	gsize start = record->len;
+	guint32 size;
+	int n;
+
+	g_string_append_len(record, "\0\0\0\0", 4);
+	g_string_append_c(record, kind);
+	for(n = 0; n < count; n++) {
+		if (fields[n]) g_string_append(record, fields[n]);
+		g_string_append_c(record, 0);
+	}
+	size = (guint32)(record->len - start - 4);
+	memcpy(record->str + start, &size, 4);
+}
+
+static gsize store_append(STATUS_STORE* store, char kind, const char** fields, int count) {
+	GString* record = g_string_sized_new(256);
+	gsize offset = store->mapped + store->tail->len;
+
+	format_record(record, kind, fields, count);
+	if (store->fp) fwrite(record->str, 1, record->len, store->fp);
+	g_string_append_len(store->tail, record->str, record->len);
+	store_index(store, offset, store->tail->str + (offset - store->mapped) + 4);
+	g_string_free(record, TRUE);
+	return offset;
+}
+
+static void copy_record(STATUS_STORE* store, GString* out, gsize offset) {
+	guint32 size;
+	const char* record = store_record(store, offset, &size);
+	g_string_append_len(out, record - 4, size + 4);
+}
+
+/**
+ * record the delta at offset goes on, or 0 when it is not a delta. lock
+ * must be held.
+ */
+static gsize delta_previous(STATUS_STORE* store, gsize offset, const char** ids, const char** end) {
+	guint32 size;
+	const char* record = store_record(store, offset, &size);
+	const char* key = record + 1;
+	const char* previous;
+	guint64 value;
+
+	*end = record + size;
+	*ids = key + strlen(key) + 1;
+	if (*record != RECORD_DELTA || *ids >= *end) return 0;
+	previous = *ids;
+	*ids += strlen(previous) + 1;
+	value = g_ascii_strtoull(previous, NULL, 10);
+	/* a delta only goes on a record written before */
+	if (value < STORE_MAGIC_SIZE || value >= offset) return 0;
+	record = store_record(store, (gsize)value, &size);
+	if ((*record != RECORD_TIMELINE && *record != RECORD_DELTA) || strcmp(record + 1, key)) return 0;
+	return (gsize)value;
+}
+
+/**
+ * status ids of the timeline at offset, newest first, at most max of them.
+ * ids added are in seen. lock must be held.
+ */
+static void store_timeline_ids(STATUS_STORE* store, gsize offset, GPtrArray* ids, GHashTable* seen, int max) {
+	while(offset && (int)ids->len < max) {
+		const char* id;
+		const char* end;
+		gsize previous = delta_previous(store, offset, &id, &end);
+
+		for(; id < end && (int)ids->len < max; id += strlen(id) + 1) {
+			if (g_hash_table_lookup(seen, id)) continue;
+			g_hash_table_insert(seen, (gpointer)id, (gpointer)id);
+			g_ptr_array_add(ids, (gpointer)id);
+		}
+		offset = previous;
+	}
+}
+
+static void collect_timeline(gpointer key, gpointer value, gpointer user_data) {
+	g_ptr_array_add((GPtrArray*)user_data, value);
+}
+
+/**
+ * rewrite the log with each timeline written whole and what they refer
+ * to. lock must be held.
+ */
+static void store_compact(STATUS_STORE* store) {
+	GString* out = g_string_new_len(STORE_MAGIC, STORE_MAGIC_SIZE);
+	GHashTable* written = g_hash_table_new(g_direct_hash, g_direct_equal);
+	GPtrArray* timelines = g_ptr_array_new();
+	guint n;
+
+	g_hash_table_foreach(store->timelines, collect_timeline, timelines);
+	for(n = 0; n < timelines->len; n++) {
+		gsize offset = GPOINTER_TO_SIZE(g_ptr_array_index(timelines, n));
+		GPtrArray* ids = g_ptr_array_new();
+		GHashTable* seen = g_hash_table_new(g_str_hash, g_str_equal);
+		guint32 size;
+		guint i;
+
+		/* key, then the ids of the deltas and of the record they go on */
+		g_ptr_array_add(ids, (gpointer)(store_record(store, offset, &size) + 1));
+		store_timeline_ids(store, offset, ids, seen, G_MAXINT);
+		for(i = 1; i < ids->len; i++) {
+			const char* id = (const char*)g_ptr_array_index(ids, i);
+			gsize status = GPOINTER_TO_SIZE(g_hash_table_lookup(store->statuses, id));
+			const char* fields[4];
+			guint32 status_size;
+			gsize user;
+
+			if (!status || g_hash_table_lookup(written, GSIZE_TO_POINTER(status))) continue;
+			if (record_fields(store_record(store, status, &status_size), status_size, fields, 4) == 4) {
+				user = GPOINTER_TO_SIZE(g_hash_table_lookup(store->users, fields[3]));
+				if (user && !g_hash_table_lookup(written, GSIZE_TO_POINTER(user))) {
+					copy_record(store, out, user);
+					g_hash_table_insert(written, GSIZE_TO_POINTER(user), GINT_TO_POINTER(TRUE));
+				}
+			}
+			copy_record(store, out, status);
+			g_hash_table_insert(written, GSIZE_TO_POINTER(status), GINT_TO_POINTER(TRUE));
+		}
+		format_record(out, RECORD_TIMELINE, (const char**)ids->pdata, ids->len);
+		g_hash_table_destroy(seen);
+		g_ptr_array_free(ids, TRUE);
+	}
+	g_ptr_array_free(timelines, TRUE);
+	g_hash_table_destroy(written);
+
+	/* the mapping goes first, or the file can't be replaced on windows */
+	if (store->fp) fclose(store->fp);
+	store->fp = NULL;
+	if (store->map) g_mapped_file_free(store->map);
+	store->map = NULL;
+	store->base = NULL;
+	store->mapped = 0;
+	g_string_truncate(store->tail, 0);
+	g_hash_table_remove_all(store->statuses);
+	g_hash_table_remove_all(store->users);
+	g_hash_table_remove_all(store->timelines);
+
+	if (g_file_set_contents(store->path, out->str, out->len, NULL))
+		store_load(store);
+	else {
+		/* keep working from memory */
+		g_string_append_len(store->tail, out->str, out->len);
+		store_scan(store, store->tail->str, store->tail->len);
+	}
+	g_string_free(out, TRUE);
+	store->compact_size = MAX(store->max_size, (store->mapped + store->tail->len)*2);
+}
+
+static void store_load(STATUS_STORE* store) {
+	gboolean torn = FALSE;
+
+	store->map = g_mapped_file_new(store->path, FALSE, NULL);
+	if (store->map) {
+		const char* data = g_mapped_file_get_contents(store->map);
+		size_t len = g_mapped_file_get_length(store->map);
+		if (data && len >= STORE_MAGIC_SIZE && !memcmp(data, STORE_MAGIC, STORE_MAGIC_SIZE)) {
+			store->base = data;
+			store->mapped = store_scan(store, data, len);
+			/* the last run went away in the middle of a record */
+			torn = store->mapped != len;
+		} else {
+			g_mapped_file_free(store->map);
+			store->map = NULL;
+		}
+	}
+	if (!store->map) {
+		g_string_append_len(store->tail, STORE_MAGIC, STORE_MAGIC_SIZE);
+		g_file_set_contents(store->path, STORE_MAGIC, STORE_MAGIC_SIZE, NULL);
+	}
+	if (torn)
+		store_compact(store);
+	else
+		store->fp = g_fopen(store->path, "ab");
+}
+
+STATUS_STORE* status_store_open(const char* path, size_t max_size) {
+	STATUS_STORE* store = g_new0(STATUS_STORE, 1);
+	gchar* dir = g_path_get_dirname(path);
+
+	g_mkdir_with_parents(dir, 0700);
+	g_free(dir);
+	store->path = g_strdup(path);
+	store->max_size = max_size;
+	store->tail = g_string_new(NULL);
+	store->statuses = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	store->users = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	store->timelines = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	store->lock = g_mutex_new();
+	store_load(store);
+	store->compact_size = max_size;
+	if (store->mapped + store->tail->len > store->compact_size)
+		store_compact(store);
+	return store;
+}
+
+void status_store_close(STATUS_STORE* store) {
+	if (!store) return;
+	if (store->fp) fclose(store->fp);
+	if (store->map) g_mapped_file_free(store->map);
+	g_string_free(store->tail, TRUE);
+	g_hash_table_destroy(store->statuses);
+	g_hash_table_destroy(store->users);
+	g_hash_table_destroy(store->timelines);
+	g_mutex_free(store->lock);
+	g_free(store->path);
+	g_free(store);
+}
+
+/**
+ * status with its user. lock must be held.
+ */
+static STATUS_INFO* store_get_status(STATUS_STORE* store, const char* status_id) {
+	gsize offset = GPOINTER_TO_SIZE(g_hash_table_lookup(store->statuses, status_id));
+	STATUS_INFO info;
+	const char* fields[5];
+	guint32 size;
+
+	if (!offset) return NULL;
+	if (record_fields(store_record(store, offset, &size), size, fields, 4) != 4) return NULL;
+	memset(&info, 0, sizeof(info));
+	info.status_id = (char*)or_null(fields[0]);
+	info.date = (char*)or_null(fields[1]);
+	info.text = (char*)or_null(fields[2]);
+	info.id = (char*)or_null(fields[3]);
+
+	offset = info.id ? GPOINTER_TO_SIZE(g_hash_table_lookup(store->users, info.id)) : 0;
+	if (offset && record_fields(store_record(store, offset, &size), size, fields, 5) == 5) {
+		info.real = (char*)or_null(fields[1]);
+		info.name = (char*)or_null(fields[2]);
+		info.icon = (char*)or_null(fields[3]);
+		info.desc = (char*)or_null(fields[4]);
+	}
+	return status_info_dup(&info);
+}
+
+/**
+ * statuses never change. the user is written again when it did.
+ */
+static void store_put_status(STATUS_STORE* store, STATUS_INFO* info) {
+	const char* fields[5];
+	gsize offset;
+
+	if (info->id) {
+		const char* user[5];
+		guint32 size;
+		offset = GPOINTER_TO_SIZE(g_hash_table_lookup(store->users, info->id));
+		user[0] = info->id;
+		user[1] = info->real;
+		user[2] = info->name;
+		user[3] = info->icon;
+		user[4] = info->desc;
+		if (!offset
+				|| record_fields(store_record(store, offset, &size), size, fields, 5) != 5
+				|| strcmp(fields[1], user[1] ? user[1] : "")
+				|| strcmp(fields[2], user[2] ? user[2] : "")
+				|| strcmp(fields[3], user[3] ? user[3] : "")
+				|| strcmp(fields[4], user[4] ? user[4] : ""))
+			store_append(store, RECORD_USER, user, 5);
+	}
+	if (g_hash_table_lookup(store->statuses, info->status_id)) return;
+	fields[0] = info->status_id;
+	fields[1] = info->date;
+	fields[2] = info->text;
+	fields[3] = info->id;
+	store_append(store, RECORD_STATUS, fields, 4);
+}
+
+STATUS_INFO* status_store_lookup(STATUS_STORE* store, const char* status_id) {
+	STATUS_INFO* info;
+
+	if (!store || !status_id) return NULL;
+	g_mutex_lock(store->lock);
+	info = store_get_status(store, status_id);
+	g_mutex_unlock(store->lock);
+	return info;
+}
+
+/**
+ * statuses of the timeline, newest first, or NULL. free each with
+ * status_info_free().
+ */
+GPtrArray* status_store_get_timeline(STATUS_STORE* store, const char* key) {
+	GPtrArray* statuses = NULL;
+	gsize offset;
+
+	if (!store) return NULL;
+	g_mutex_lock(store->lock);
+	offset = GPOINTER_TO_SIZE(g_hash_table_lookup(store->timelines, key));
+	if (offset) {
+		GPtrArray* ids = g_ptr_array_new();
+		GHashTable* seen = g_hash_table_new(g_str_hash, g_str_equal);
+		guint n;
+
+		store_timeline_ids(store, offset, ids, seen, G_MAXINT);
+		statuses = g_ptr_array_new();
+		for(n = 0; n < ids->len; n++) {
+			STATUS_INFO* info = store_get_status(store, (const char*)g_ptr_array_index(ids, n));
+			if (info) g_ptr_array_add(statuses, info);
+		}
+		g_hash_table_destroy(seen);
+		g_ptr_array_free(ids, TRUE);
+		if (statuses->len == 0) {
+			g_ptr_array_free(statuses, TRUE);
+			statuses = NULL;
+		}
+	}
+	g_mutex_unlock(store->lock);
+	return statuses;
+}
+
+/**
+ * write the statuses and the order of the timeline. statuses are newest
+ * first. unless replace, they go on top of what the timeline had: their
+ * ids are appended as a delta, and the timeline is written whole again
+ * after STORE_DELTA_MAX deltas or when the deltas hold a quarter of
+ * max_statuses.
+ */
+void status_store_update_timeline(STATUS_STORE* store, const char* key, GPtrArray* statuses, gboolean replace, int max_statuses) {
+	GPtrArray* fields;
+	GHashTable* seen;
+	gsize offset, delta;
+	char previous[32];
+	int deltas = 0, delta_ids = 0;
+	guint n;
+
+	if (!store) return;
+	g_mutex_lock(store->lock);
+	offset = replace ? 0 : GPOINTER_TO_SIZE(g_hash_table_lookup(store->timelines, key));
+	for(delta = offset; delta; deltas++) {
+		const char* id;
+		const char* end;
+		gsize next = delta_previous(store, delta, &id, &end);
+		if (!next) break;
+		for(; id < end; id += strlen(id) + 1) delta_ids++;
+		delta = next;
+	}
+
+	/* key and previous go first, previous is dropped when written whole */
+	g_snprintf(previous, sizeof(previous), "%lu", (unsigned long)offset);
+	fields = g_ptr_array_new();
+	seen = g_hash_table_new(g_str_hash, g_str_equal);
+	g_ptr_array_add(fields, (gpointer)key);
+	g_ptr_array_add(fields, previous);
+	for(n = 0; n < statuses->len; n++) {
+		STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+		if (!info->status_id || !*info->status_id) continue;
+		store_put_status(store, info);
+		if ((int)fields->len > max_statuses + 1 || g_hash_table_lookup(seen, info->status_id)) continue;
+		g_hash_table_insert(seen, info->status_id, info->status_id);
+		g_ptr_array_add(fields, info->status_id);
+	}
+
+	if (offset && fields->len == 2) {
+		/* nothing new to the timeline */
+	} else
+	if (offset && deltas < STORE_DELTA_MAX && delta_ids + (int)fields->len - 2 < max_statuses/4) {
+		store_append(store, RECORD_DELTA, (const char**)fields->pdata, fields->len);
+	} else {
+		g_ptr_array_remove_index(fields, 1);
+		/* ids of the old records stay valid until the new one is appended */
+		if (offset) store_timeline_ids(store, offset, fields, seen, max_statuses + 1);
+		store_append(store, RECORD_TIMELINE, (const char**)fields->pdata, fields->len);
+	}
+	g_hash_table_destroy(seen);
+	g_ptr_array_free(fields, TRUE);
+
+	if (store->mapped + store->tail->len > store->compact_size)
+		store_compact(store);
+	if (store->fp) fflush(store->fp);
+	g_mutex_unlock(store->lock);
+}
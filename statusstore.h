@@ -0,0 +1,24 @@
+#ifndef _STATUSSTORE_H_
+#define _STATUSSTORE_H_
+
+#include <glib.h>
+#include "status.h"
+
+/**
+ * local status store
+ *
+ * parsed statuses, their users and the order of each timeline are appended
+ * to one log file. the log is mapped at open and indexed by status id, so
+ * timelines of the last run can be shown without the network. records
+ * appended later are kept in memory as well. when the log grows over
+ * max_size, it is rewritten with what the timelines still refer to.
+ */
+typedef struct _STATUS_STORE STATUS_STORE;
+
+STATUS_STORE* status_store_open(const char* path, size_t max_size);
+void status_store_close(STATUS_STORE* store);
+STATUS_INFO* status_store_lookup(STATUS_STORE* store, const char* status_id);
+GPtrArray* status_store_get_timeline(STATUS_STORE* store, const char* key);
+void status_store_update_timeline(STATUS_STORE* store, const char* key, GPtrArray* statuses, gboolean replace, int max_statuses);
+
+#endif /* _STATUSSTORE_H_ */
@@ -0,0 +1,109 @@
+#include <string.h>
+#include "statustext.h"
+
+/**
+ * classes of bytes
+ */
+#define CHAR_URL    (1 << 0)	/* may be in an url */
+#define CHAR_NAME   (1 << 1)	/* may be in a screen name */
+#define CHAR_DIGIT  (1 << 2)	/* may be in a status id */
+#define CHAR_MARK   (1 << 3)	/* may start a token */
+
+#define ACCEPT_LETTER_URL   "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789;/?:@&=+$,-_.!~*'%"
+#define ACCEPT_LETTER_NAME  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"
+#define ACCEPT_LETTER_REPLY "0123456789"
+#define TOKEN_MARKS         "hf@>\xef"
+
+#define FULLWIDTH_AT        "\xef\xbc\xa0"
+
+static unsigned char char_class[256];
+static GStaticMutex char_class_lock = G_STATIC_MUTEX_INIT;
+static gboolean char_class_ready = FALSE;
+
+static void set_char_class(const char* letters, unsigned char flag) {
+	while (*letters)
+		char_class[(unsigned char)*letters++] |= flag;
+}
+
+static void init_char_class(void) {
+	g_static_mutex_lock(&char_class_lock);
+	if (!char_class_ready) {
+		set_char_class(ACCEPT_LETTER_URL, CHAR_URL);
+		set_char_class(ACCEPT_LETTER_NAME, CHAR_NAME);
+		set_char_class(ACCEPT_LETTER_REPLY, CHAR_DIGIT);
+		set_char_class(TOKEN_MARKS, CHAR_MARK);
+		char_class_ready = TRUE;
+	}
+	g_static_mutex_unlock(&char_class_lock);
+}
+
+static const char* skip_class(const char* ptr, unsigned char flag) {
+	while (char_class[(unsigned char)*ptr] & flag) ptr++;
+	return ptr;
+}
+
+static void add_token(GArray* tokens, STATUS_TOKEN_KIND kind, const char* text, int len, const char* value, int value_len) {
+	STATUS_TOKEN token;
+	token.kind = kind;
+	token.text = text;
+	token.len = len;
+	token.value = value;
+	token.value_len = value_len;
+	g_array_append_val(tokens, token);
+}
+
+/**
+ * append the tokens of the text. returns how many were added.
+ */
+int status_text_tokenize(const char* text, int flags, GArray* tokens) {
+	const char* ptr = text;
+	const char* last = text;
+	guint first = tokens->len;
+
+	if (!text) return 0;
+	if (!char_class_ready) init_char_class();
+
+	while (*ptr) {
+		const char* value = NULL;
+		const char* end;
+		STATUS_TOKEN_KIND kind;
+
+		/* plain text, multibyte letters included, goes at once */
+		if (!(char_class[(unsigned char)*ptr] & CHAR_MARK)) {
+			ptr++;
+			continue;
+		}
+
+		if ((flags & STATUS_TEXT_URLS) && (!strncmp(ptr, "http://", 7) || !strncmp(ptr, "ftp://", 6))) {
+			kind = STATUS_TOKEN_URL;
+			value = ptr;
+			end = skip_class(ptr, CHAR_URL);
+		} else
+		if ((flags & STATUS_TEXT_MENTIONS) && (*ptr == '@' || !strncmp(ptr, FULLWIDTH_AT, 3))) {
+			kind = STATUS_TOKEN_MENTION;
+			value = ptr + (*ptr == '@' ? 1 : 3);
+			end = skip_class(value, CHAR_NAME);
+		} else
+		if ((flags & STATUS_TEXT_REPLIES) && ptr[0] == '>' && ptr[1] == '>') {
+			kind = STATUS_TOKEN_REPLY;
+			value = ptr + 2;
+			end = skip_class(value, CHAR_DIGIT);
+		} else {
+			ptr++;
+			continue;
+		}
+
+		if (end == value) {
+			/* a marker alone is plain text */
+			ptr = end;
+			continue;
+		}
+		if (last != ptr)
+			add_token(tokens, STATUS_TOKEN_TEXT, last, (int)(ptr - last), last, (int)(ptr - last));
+		add_token(tokens, kind, ptr, (int)(end - ptr), value, (int)(end - value));
+		ptr = last = end;
+	}
+	if (last != ptr)
+		add_token(tokens, STATUS_TOKEN_TEXT, last, (int)(ptr - last), last, (int)(ptr - last));
+	return (int)(tokens->len - first);
+}
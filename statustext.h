@@ -0,0 +1,36 @@
+#ifndef _STATUSTEXT_H_
+#define _STATUSTEXT_H_
+
+#include <glib.h>
+
+/**
+ * status text tokenizer
+ *
+ * splits a status into plain text, urls, "@name" mentions and
+ * ">>status_id" replies in one pass. bytes are classified by a table, so
+ * plain text and multibyte letters are skipped without looking at the
+ * markers. tokens point into the scanned text, nothing is copied.
+ */
+#define STATUS_TEXT_URLS      (1 << 0)
+#define STATUS_TEXT_MENTIONS  (1 << 1)
+#define STATUS_TEXT_REPLIES   (1 << 2)
+#define STATUS_TEXT_ALL       (STATUS_TEXT_URLS | STATUS_TEXT_MENTIONS | STATUS_TEXT_REPLIES)
+
+typedef enum {
+	STATUS_TOKEN_TEXT,
+	STATUS_TOKEN_URL,
+	STATUS_TOKEN_MENTION,
+	STATUS_TOKEN_REPLY
+} STATUS_TOKEN_KIND;
+
+typedef struct _STATUS_TOKEN {
+	STATUS_TOKEN_KIND kind;
+	const char* text;	/* whole token, marker included */
+	int len;
+	const char* value;	/* url, user name or status id */
+	int value_len;
+} STATUS_TOKEN;
+
+int status_text_tokenize(const char* text, int flags, GArray* tokens);
+
+#endif /* _STATUSTEXT_H_ */
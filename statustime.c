@@ -0,0 +1,348 @@
+#include <stdlib.h>
+#include <string.h>
+#include "statustime.h"
+
+#define STATUS_ID_SIZE     24
+#define UTC_OFFSET_SPAN    3600
+
+/**
+ * calendar
+ */
+static long days_from_civil(long y, int m, int d) {
+	long era, yoe, doy, doe;
+
+	y -= m <= 2;
+	era = (y >= 0 ? y : y - 399) / 400;
+	yoe = y - era * 400;
+	doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+static void civil_from_days(long z, struct tm* tm) {
+	long era, doe, yoe, doy, mp, y;
+	int m;
+
+	tm->tm_wday = (int)((z % 7 + 11) % 7);	/* 1970-01-01 was thursday */
+	z += 719468;
+	era = (z >= 0 ? z : z - 146096) / 146097;
+	doe = z - era * 146097;
+	yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	y = yoe + era * 400;
+	doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	mp = (5 * doy + 2) / 153;
+	m = (int)(mp < 10 ? mp + 3 : mp - 9);
+	y += m <= 2;
+	tm->tm_mday = (int)(doy - (153 * mp + 2) / 5 + 1);
+	tm->tm_mon = m - 1;
+	tm->tm_year = (int)(y - 1900);
+	tm->tm_yday = (int)(z - 719468 - days_from_civil(y, 1, 1));
+}
+
+/**
+ * parse exactly count digits.
+ */
+static int parse_digits(const char** s, int count) {
+	const char* p = *s;
+	int value = 0;
+
+	while (count-- > 0) {
+		if (*p < '0' || *p > '9') return -1;
+		value = value * 10 + (*p++ - '0');
+	}
+	*s = p;
+	return value;
+}
+
+/**
+ * "Wed Aug 27 13:08:45 +0000 2008"
+ */
+time_t status_time_parse(const char* s) {
+	static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	static const int mdays[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	int mon, mday, hour, min, sec, year, zone, sign;
+	long days;
+
+	if (!s) return -1;
+
+	/* Wed */
+	if (strlen(s) < 30 || s[3] != ' ') return -1;
+	s += 4;
+
+	/* Aug */
+	for(mon = 0; mon < 12; mon++)
+		if (!memcmp(s, months + mon * 3, 3)) break;
+	if (mon == 12 || s[3] != ' ') return -1;
+	s += 4;
+
+	/* 27 */
+	mday = parse_digits(&s, 2);
+	if (mday < 1 || mday > mdays[mon] || *s++ != ' ') return -1;
+
+	/* 13:08:45 */
+	hour = parse_digits(&s, 2);
+	if (hour < 0 || hour > 23 || *s++ != ':') return -1;
+	min = parse_digits(&s, 2);
+	if (min < 0 || min > 59 || *s++ != ':') return -1;
+	sec = parse_digits(&s, 2);
+	if (sec < 0 || sec > 60 || *s++ != ' ') return -1;
+
+	/* +0000 */
+	if (*s != '+' && *s != '-') return -1;
+	sign = *s++ == '-' ? -1 : 1;
+	zone = parse_digits(&s, 4);
+	if (zone < 0 || *s++ != ' ') return -1;
+	zone = sign * ((zone / 100) * 3600 + (zone % 100) * 60);
+
+	/* 2008 */
+	year = parse_digits(&s, 4);
+	if (year < 1970 || (*s && *s != ' ')) return -1;
+	if (mon == 1 && mday == 29 && !(year % 4 == 0 && (year % 100 != 0 || year % 400 == 0))) return -1;
+
+	days = days_from_civil(year, mon + 1, mday);
+	return (time_t)(days * 86400 + hour * 3600 + min * 60 + sec - zone);
+}
+
+/**
+ * offset of the local time is asked to the C library once an hour. times
+ * far from now are shown with the offset of now, even over a change of
+ * daylight saving time.
+ */
+static GStaticMutex utc_offset_lock = G_STATIC_MUTEX_INIT;
+static long utc_offset = 0;
+static time_t utc_offset_until = 0;
+
+static long get_utc_offset(void) {
+	time_t now = time(NULL);
+	long offset;
+
+	g_static_mutex_lock(&utc_offset_lock);
+	if (now >= utc_offset_until || now + UTC_OFFSET_SPAN < utc_offset_until) {
+		struct tm* local = localtime(&now);
+		if (local) {
+			long seconds = days_from_civil(local->tm_year + 1900, local->tm_mon + 1, local->tm_mday) * 86400
+				+ local->tm_hour * 3600 + local->tm_min * 60 + local->tm_sec;
+			utc_offset = (long)(seconds - now);
+		}
+		utc_offset_until = now - now % UTC_OFFSET_SPAN + UTC_OFFSET_SPAN;
+	}
+	offset = utc_offset;
+	g_static_mutex_unlock(&utc_offset_lock);
+	return offset;
+}
+
+void status_time_local(time_t t, struct tm* tm) {
+	long seconds = (long)t + get_utc_offset();
+	long days = seconds >= 0 ? seconds / 86400 : -((-seconds + 86399) / 86400);
+	long rest = seconds - days * 86400;
+
+	memset(tm, 0, sizeof(struct tm));
+	civil_from_days(days, tm);
+	tm->tm_hour = (int)(rest / 3600);
+	tm->tm_min = (int)(rest % 3600 / 60);
+	tm->tm_sec = (int)(rest % 60);
+	tm->tm_isdst = -1;
+}
+
+/**
+ * order of status ids. ids are decimal numbers of any length.
+ */
+static int compare_status_id(const char* a, const char* b) {
+	size_t alen = a ? strlen(a) : 0;
+	size_t blen = b ? strlen(b) : 0;
+
+	if (alen != blen) return alen < blen ? -1 : 1;
+	return alen ? strcmp(a, b) : 0;
+}
+
+/**
+ * newer goes first. negative if a goes before b.
+ */
+static int compare_status_time(time_t atime, const char* aid, time_t btime, const char* bid) {
+	if (atime != btime) return atime > btime ? -1 : 1;
+	return -compare_status_id(aid, bid);
+}
+
+/**
+ * sort statuses from the newest, times go along. timelines come sorted
+ * mostly, so that is checked first.
+ */
+typedef struct _TIMED_STATUS {
+	time_t time;
+	STATUS_INFO* info;
+} TIMED_STATUS;
+
+static int compare_timed_status(const void* a, const void* b) {
+	const TIMED_STATUS* sa = (const TIMED_STATUS*)a;
+	const TIMED_STATUS* sb = (const TIMED_STATUS*)b;
+	return compare_status_time(sa->time, sa->info->status_id, sb->time, sb->info->status_id);
+}
+
+void status_time_sort(GPtrArray* statuses, time_t* times) {
+	TIMED_STATUS* timed;
+	guint n;
+
+	for(n = 1; n < statuses->len; n++) {
+		STATUS_INFO* prev = (STATUS_INFO*)g_ptr_array_index(statuses, n - 1);
+		STATUS_INFO* info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+		if (compare_status_time(times[n - 1], prev->status_id, times[n], info->status_id) > 0) break;
+	}
+	if (n >= statuses->len) return;
+
+	timed = g_new(TIMED_STATUS, statuses->len);
+	for(n = 0; n < statuses->len; n++) {
+		timed[n].time = times[n];
+		timed[n].info = (STATUS_INFO*)g_ptr_array_index(statuses, n);
+	}
+	qsort(timed, statuses->len, sizeof(TIMED_STATUS), compare_timed_status);
+	for(n = 0; n < statuses->len; n++) {
+		times[n] = timed[n].time;
+		g_ptr_array_index(statuses, n) = timed[n].info;
+	}
+	g_free(timed);
+}
+
+/**
+ * merge timelines sorted by status_time_sort into one, newest first. a
+ * status in more than one of them is taken once, the others are freed.
+ * statuses are moved out of the timelines, which are left empty. count is
+ * small, so the newest head is looked for in turn.
+ */
+GPtrArray* status_time_merge(GPtrArray** timelines, time_t** times, int count, time_t** merged_times) {
+	GPtrArray* merged;
+	STATUS_INFO* last = NULL;
+	time_t last_time = 0;
+	guint* heads = g_new0(guint, count);
+	guint total = 0;
+	int n;
+
+	for(n = 0; n < count; n++)
+		total += timelines[n]->len;
+	merged = g_ptr_array_sized_new(total);
+	*merged_times = malloc((total+1)*sizeof(time_t));
+
+	for(;;) {
+		STATUS_INFO* info;
+		int newest = -1;
+		for(n = 0; n < count; n++) {
+			STATUS_INFO* head;
+			if (heads[n] >= timelines[n]->len) continue;
+			head = (STATUS_INFO*)g_ptr_array_index(timelines[n], heads[n]);
+			if (newest < 0 || compare_status_time(times[n][heads[n]], head->status_id,
+						times[newest][heads[newest]],
+						((STATUS_INFO*)g_ptr_array_index(timelines[newest], heads[newest]))->status_id) < 0)
+				newest = n;
+		}
+		if (newest < 0) break;
+
+		info = (STATUS_INFO*)g_ptr_array_index(timelines[newest], heads[newest]);
+		if (last && compare_status_time(last_time, last->status_id, times[newest][heads[newest]], info->status_id) == 0) {
+			/* same status, from another timeline */
+			status_info_free(info);
+		} else {
+			(*merged_times)[merged->len] = times[newest][heads[newest]];
+			g_ptr_array_add(merged, info);
+			last = info;
+			last_time = times[newest][heads[newest]];
+		}
+		heads[newest]++;
+	}
+
+	for(n = 0; n < count; n++)
+		g_ptr_array_set_size(timelines[n], 0);
+	g_free(heads);
+	return merged;
+}
+
+/**
+ * time ordered index
+ */
+typedef struct _INDEX_ENTRY {
+	time_t time;
+	char status_id[STATUS_ID_SIZE];
+} INDEX_ENTRY;
+
+struct _STATUS_INDEX {
+	GArray* entries;
+};
+
+STATUS_INDEX* status_index_new(void) {
+	STATUS_INDEX* index = g_new0(STATUS_INDEX, 1);
+	index->entries = g_array_new(FALSE, FALSE, sizeof(INDEX_ENTRY));
+	return index;
+}
+
+void status_index_free(STATUS_INDEX* index) {
+	if (!index) return;
+	g_array_free(index->entries, TRUE);
+	g_free(index);
+}
+
+void status_index_clear(STATUS_INDEX* index) {
+	g_array_set_size(index->entries, 0);
+}
+
+/**
+ * position where the status is or would go.
+ */
+static guint index_search(STATUS_INDEX* index, const char* status_id, time_t time, gboolean* found) {
+	guint low = 0, high = index->entries->len;
+
+	*found = FALSE;
+	while (low < high) {
+		guint mid = (low + high) / 2;
+		INDEX_ENTRY* entry = &g_array_index(index->entries, INDEX_ENTRY, mid);
+		int cmp = compare_status_time(entry->time, entry->status_id, time, status_id);
+		if (cmp == 0) {
+			*found = TRUE;
+			return mid;
+		}
+		if (cmp < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+/**
+ * returns the position of the status, or -1 when it was there already.
+ */
+int status_index_insert(STATUS_INDEX* index, const char* status_id, time_t time) {
+	INDEX_ENTRY entry;
+	gboolean found;
+	guint pos;
+
+	if (!status_id || strlen(status_id) >= STATUS_ID_SIZE) return -1;
+	pos = index_search(index, status_id, time, &found);
+	if (found) return -1;
+	entry.time = time;
+	strcpy(entry.status_id, status_id);
+	g_array_insert_val(index->entries, pos, entry);
+	return (int)pos;
+}
+
+int status_index_find(STATUS_INDEX* index, const char* status_id, time_t time) {
+	gboolean found;
+	guint pos;
+
+	if (!status_id) return -1;
+	pos = index_search(index, status_id, time, &found);
+	return found ? (int)pos : -1;
+}
+
+void status_index_trim(STATUS_INDEX* index, guint length) {
+	if (index->entries->len > length) g_array_set_size(index->entries, length);
+}
+
+guint status_index_length(STATUS_INDEX* index) {
+	return index->entries->len;
+}
+
+const char* status_index_id(STATUS_INDEX* index, guint n) {
+	return g_array_index(index->entries, INDEX_ENTRY, n).status_id;
+}
+
+time_t status_index_time(STATUS_INDEX* index, guint n) {
+	return g_array_index(index->entries, INDEX_ENTRY, n).time;
+}
@@ -0,0 +1,38 @@
+#ifndef _STATUSTIME_H_
+#define _STATUSTIME_H_
+
+#include <time.h>
+#include <glib.h>
+#include "status.h"
+
+/**
+ * created_at of statuses
+ *
+ * "Wed Aug 27 13:08:45 +0000 2008" is parsed to seconds since the epoch
+ * without allocating and without asking the timezone database. local time
+ * is made from an utc offset which is looked up once an hour.
+ */
+time_t status_time_parse(const char* s);
+void status_time_local(time_t t, struct tm* tm);
+void status_time_sort(GPtrArray* statuses, time_t* times);
+GPtrArray* status_time_merge(GPtrArray** timelines, time_t** times, int count, time_t** merged_times);
+
+/**
+ * time ordered index
+ *
+ * status ids ordered from the newest. statuses of the same second are
+ * ordered by id. an id is there at most once.
+ */
+typedef struct _STATUS_INDEX STATUS_INDEX;
+
+STATUS_INDEX* status_index_new(void);
+void status_index_free(STATUS_INDEX* index);
+void status_index_clear(STATUS_INDEX* index);
+int status_index_insert(STATUS_INDEX* index, const char* status_id, time_t time);
+int status_index_find(STATUS_INDEX* index, const char* status_id, time_t time);
+void status_index_trim(STATUS_INDEX* index, guint length);
+guint status_index_length(STATUS_INDEX* index);
+const char* status_index_id(STATUS_INDEX* index, guint n);
+time_t status_index_time(STATUS_INDEX* index, guint n);
+
+#endif /* _STATUSTIME_H_ */
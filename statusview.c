@@ -0,0 +1,540 @@
+#include <stdlib.h>
+#include <string.h>
+#include "statusview.h"
+
+typedef struct _STATUS_LINK {
+	int start;		/* byte range in text */
+	int end;
+	char* link;
+	char* user_id;
+} STATUS_LINK;
+
+struct _STATUS_ROW {
+	GdkPixbuf* icon;
+	GString* text;		/* "name (real)\nmessage\ndate" */
+	GArray* links;		/* STATUS_LINK */
+	int name_end;		/* end of the name */
+	int date_start;		/* start of the date, or -1 */
+	char* date;		/* appended when inserted */
+	int height;		/* measured height, or -1 */
+	PangoLayout* layout;	/* bound while near the viewport */
+};
+
+struct _STATUS_VIEW {
+	GtkWidget* box;
+	GtkWidget* area;
+	GtkWidget* scrollbar;
+	GtkAdjustment* adjustment;
+	GPtrArray* rows;	/* STATUS_ROW, newest first */
+	int* offsets;		/* top of each row, and the total height at last */
+	guint offsets_size;
+	int offsets_stale;	/* first row whose bottom is not in offsets, or -1 */
+	int scroll_shift;	/* added to the adjustment with the next offsets */
+	int width;		/* width of the layouts */
+	int bound_first;	/* rows holding a layout */
+	int bound_last;
+	GSList* pool;		/* recycled layouts */
+	GdkCursor* hand_cursor;
+	GdkCursor* watch_cursor;
+	gboolean hovering;
+	gboolean busy;
+	STATUS_LINK_FUNC func;
+	gpointer user_data;
+};
+
+/**
+ * row
+ */
+STATUS_ROW* status_row_new(GdkPixbuf* icon, const char* user_id, const char* name, const char* real, const char* date) {
+	STATUS_ROW* row = g_new0(STATUS_ROW, 1);
+	STATUS_LINK link;
+
+	row->icon = icon ? g_object_ref(icon) : NULL;
+	row->text = g_string_sized_new(256);
+	row->links = g_array_new(FALSE, FALSE, sizeof(STATUS_LINK));
+	row->height = -1;
+	row->date_start = -1;
+	row->date = g_strdup(date);
+
+	/* name works as a link to the user timeline */
+	g_string_append(row->text, name ? name : "");
+	row->name_end = row->text->len;
+	link.start = 0;
+	link.end = row->name_end;
+	link.link = g_strdup_printf("@%s", name ? name : "");
+	link.user_id = g_strdup(user_id);
+	g_array_append_val(row->links, link);
+	g_string_append(row->text, " (");
+	if (real) g_string_append(row->text, real);
+	g_string_append(row->text, ")\n");
+	return row;
+}
+
+/**
+ * append a piece of the message. link is NULL for plain text.
+ */
+void status_row_append(STATUS_ROW* row, const char* text, int len, const char* link, const char* user_id) {
+	if (len < 0) len = strlen(text);
+	if (link) {
+		STATUS_LINK item;
+		item.start = row->text->len;
+		item.end = row->text->len + len;
+		item.link = g_strdup(link);
+		item.user_id = g_strdup(user_id);
+		g_array_append_val(row->links, item);
+	}
+	g_string_append_len(row->text, text, len);
+}
+
+static void status_row_finish(STATUS_ROW* row) {
+	if (row->date_start >= 0) return;
+	g_string_append_c(row->text, '\n');
+	row->date_start = row->text->len;
+	if (row->date) g_string_append(row->text, row->date);
+	g_free(row->date);
+	row->date = NULL;
+}
+
+void status_row_free(STATUS_ROW* row) {
+	guint n;
+
+	if (!row) return;
+	for(n = 0; n < row->links->len; n++) {
+		STATUS_LINK* link = &g_array_index(row->links, STATUS_LINK, n);
+		g_free(link->link);
+		g_free(link->user_id);
+	}
+	g_array_free(row->links, TRUE);
+	g_string_free(row->text, TRUE);
+	if (row->layout) g_object_unref(row->layout);
+	if (row->icon) g_object_unref(row->icon);
+	g_free(row->date);
+	g_free(row);
+}
+
+static void add_attr(PangoAttrList* attrs, PangoAttribute* attr, int start, int end) {
+	attr->start_index = start;
+	attr->end_index = end;
+	pango_attr_list_insert(attrs, attr);
+}
+
+static PangoAttrList* status_row_attrs(STATUS_ROW* row) {
+	PangoAttrList* attrs = pango_attr_list_new();
+	guint n;
+
+	add_attr(attrs, pango_attr_scale_new(PANGO_SCALE_LARGE), 0, row->name_end);
+	add_attr(attrs, pango_attr_weight_new(PANGO_WEIGHT_BOLD), 0, row->name_end);
+	for(n = 0; n < row->links->len; n++) {
+		STATUS_LINK* link = &g_array_index(row->links, STATUS_LINK, n);
+		add_attr(attrs, pango_attr_foreground_new(0, 0, 0xffff), link->start, link->end);
+		add_attr(attrs, pango_attr_underline_new(PANGO_UNDERLINE_SINGLE), link->start, link->end);
+	}
+	add_attr(attrs, pango_attr_scale_new(PANGO_SCALE_X_SMALL), row->date_start, row->text->len);
+	add_attr(attrs, pango_attr_style_new(PANGO_STYLE_ITALIC), row->date_start, row->text->len);
+	add_attr(attrs, pango_attr_foreground_new(0, 0x5500, 0), row->date_start, row->text->len);
+	return attrs;
+}
+
+/**
+ * layout pool
+ */
+static int layout_width(STATUS_VIEW* view) {
+	int width = view->width - STATUS_VIEW_ICON_SIZE - STATUS_VIEW_PADDING*3;
+	return width > 1 ? width : 1;
+}
+
+static int row_height(STATUS_ROW* row) {
+	return row->height >= 0 ? row->height : STATUS_VIEW_ESTIMATED_ROW;
+}
+
+/**
+ * offsets below the top of row n must be made again.
+ */
+static void invalidate_offsets(STATUS_VIEW* view, int n) {
+	if (view->offsets_stale < 0 || n < view->offsets_stale) view->offsets_stale = n;
+}
+
+/**
+ * give the row n a layout, and measure it if it was not yet. returns how
+ * much the height of the row changed.
+ */
+static int bind_row(STATUS_VIEW* view, int n) {
+	STATUS_ROW* row = (STATUS_ROW*)g_ptr_array_index(view->rows, n);
+	PangoAttrList* attrs;
+	int old_height = row_height(row);
+	int height = 0;
+
+	if (row->layout) return 0;
+	if (view->pool) {
+		row->layout = (PangoLayout*)view->pool->data;
+		view->pool = g_slist_delete_link(view->pool, view->pool);
+	} else {
+		row->layout = gtk_widget_create_pango_layout(view->area, NULL);
+		pango_layout_set_wrap(row->layout, PANGO_WRAP_WORD_CHAR);
+	}
+	pango_layout_set_width(row->layout, layout_width(view)*PANGO_SCALE);
+	pango_layout_set_text(row->layout, row->text->str, row->text->len);
+	attrs = status_row_attrs(row);
+	pango_layout_set_attributes(row->layout, attrs);
+	pango_attr_list_unref(attrs);
+
+	if (row->height >= 0) return 0;
+	pango_layout_get_pixel_size(row->layout, NULL, &height);
+	row->height = MAX(height, STATUS_VIEW_ICON_SIZE) + STATUS_VIEW_PADDING*2;
+	if (row->height != old_height) invalidate_offsets(view, n);
+	return row->height - old_height;
+}
+
+static void unbind_row(STATUS_VIEW* view, STATUS_ROW* row) {
+	if (!row->layout) return;
+	pango_layout_set_attributes(row->layout, NULL);
+	view->pool = g_slist_prepend(view->pool, row->layout);
+	row->layout = NULL;
+}
+
+static void unbind_all(STATUS_VIEW* view) {
+	int n;
+	for(n = view->bound_first; n <= view->bound_last && n < (int)view->rows->len; n++)
+		unbind_row(view, (STATUS_ROW*)g_ptr_array_index(view->rows, n));
+	view->bound_first = 0;
+	view->bound_last = -1;
+}
+
+/**
+ * geometry
+ */
+static void update_adjustment(STATUS_VIEW* view) {
+	GtkAdjustment* adj = view->adjustment;
+	int total = view->offsets[view->rows->len];
+	int page = view->area->allocation.height;
+
+	adj->lower = 0;
+	adj->upper = MAX(total, page);
+	adj->page_size = page;
+	adj->page_increment = page*0.9;
+	adj->step_increment = STATUS_VIEW_ESTIMATED_ROW/2;
+	if (adj->value > adj->upper - adj->page_size)
+		adj->value = MAX(adj->upper - adj->page_size, 0);
+	gtk_adjustment_changed(adj);
+}
+
+/**
+ * make offsets right down to the top of row last. rows above the first one
+ * changed keep theirs, so a row inserted or measured near the top costs
+ * little and many changes in a row are paid once.
+ */
+static void update_offsets_to(STATUS_VIEW* view, int last) {
+	int n;
+
+	if (view->offsets_stale < 0 || view->offsets_stale >= last) return;
+	if (view->offsets_size < view->rows->len + 1) {
+		view->offsets_size = MAX(view->rows->len + 1, view->offsets_size*2);
+		view->offsets = g_renew(int, view->offsets, view->offsets_size);
+	}
+	for(n = view->offsets_stale; n < last; n++)
+		view->offsets[n+1] = view->offsets[n] + row_height((STATUS_ROW*)g_ptr_array_index(view->rows, n));
+	view->offsets_stale = last < (int)view->rows->len ? last : -1;
+}
+
+static void update_offsets(STATUS_VIEW* view) {
+	int shift = view->scroll_shift;
+
+	if (view->offsets_stale < 0) return;
+	update_offsets_to(view, view->rows->len);
+	view->offsets_stale = -1;
+	update_adjustment(view);
+	if (shift) {
+		view->scroll_shift = 0;
+		gtk_adjustment_set_value(view->adjustment, view->adjustment->value + shift);
+	}
+}
+
+/**
+ * row at the position, or -1.
+ */
+static int find_row(STATUS_VIEW* view, int y) {
+	int low = 0, high = (int)view->rows->len - 1;
+
+	update_offsets(view);
+	if (high < 0 || y < 0 || y >= view->offsets[view->rows->len]) return -1;
+	while(low < high) {
+		int mid = (low + high + 1) / 2;
+		if (view->offsets[mid] <= y) low = mid;
+		else high = mid - 1;
+	}
+	return low;
+}
+
+/**
+ * find the link under the point of the widget.
+ */
+static STATUS_LINK* hit_link(STATUS_VIEW* view, int x, int y) {
+	STATUS_ROW* row;
+	int top = (int)view->adjustment->value;
+	int index = 0, trailing = 0;
+	int n = find_row(view, y + top);
+	guint i;
+
+	if (n < 0) return NULL;
+	row = (STATUS_ROW*)g_ptr_array_index(view->rows, n);
+	if (!row->layout) return NULL;
+	x -= STATUS_VIEW_ICON_SIZE + STATUS_VIEW_PADDING*2;
+	y += top - view->offsets[n] - STATUS_VIEW_PADDING;
+	if (!pango_layout_xy_to_index(row->layout, x*PANGO_SCALE, y*PANGO_SCALE, &index, &trailing))
+		return NULL;
+	for(i = 0; i < row->links->len; i++) {
+		STATUS_LINK* link = &g_array_index(row->links, STATUS_LINK, i);
+		if (index >= link->start && index < link->end) return link;
+	}
+	return NULL;
+}
+
+/**
+ * signals
+ */
+static gboolean status_view_expose(GtkWidget* area, GdkEventExpose* event, STATUS_VIEW* view) {
+	int len = (int)view->rows->len;
+	int page = area->allocation.height;
+	int top, first, last, n, y, delta = 0;
+
+	gdk_draw_rectangle(area->window, area->style->base_gc[GTK_STATE_NORMAL], TRUE,
+			event->area.x, event->area.y, event->area.width, event->area.height);
+	if (len == 0) return TRUE;
+
+	/* rows in the viewport. rows inserted above may move it first */
+	update_offsets(view);
+	top = (int)view->adjustment->value;
+	first = find_row(view, top);
+	if (first < 0) first = len - 1;
+	y = view->offsets[first];
+	for(last = first; last < len; last++) {
+		bind_row(view, last);
+		y += row_height((STATUS_ROW*)g_ptr_array_index(view->rows, last));
+		if (y >= top + page) break;
+	}
+	if (last >= len) last = len - 1;
+
+	/* margin. rows measured above the viewport must not move it */
+	for(n = MAX(first - STATUS_VIEW_MARGIN_ROWS, 0); n < first; n++)
+		delta += bind_row(view, n);
+	for(n = last + 1; n < len && n <= last + STATUS_VIEW_MARGIN_ROWS; n++)
+		bind_row(view, n);
+
+	/* recycle layouts of rows gone away */
+	for(n = view->bound_first; n <= view->bound_last && n < len; n++)
+		if (n < first - STATUS_VIEW_MARGIN_ROWS || n > last + STATUS_VIEW_MARGIN_ROWS)
+			unbind_row(view, (STATUS_ROW*)g_ptr_array_index(view->rows, n));
+	view->bound_first = MAX(first - STATUS_VIEW_MARGIN_ROWS, 0);
+	view->bound_last = MIN(last + STATUS_VIEW_MARGIN_ROWS, len - 1);
+
+	update_offsets(view);
+	if (delta) {
+		gtk_adjustment_set_value(view->adjustment, top + delta);
+		return TRUE;
+	}
+
+	for(n = first; n <= last; n++) {
+		STATUS_ROW* row = (STATUS_ROW*)g_ptr_array_index(view->rows, n);
+		y = view->offsets[n] - top;
+		if (y + row_height(row) < event->area.y || y > event->area.y + event->area.height) continue;
+		if (row->icon)
+			gdk_draw_pixbuf(area->window, NULL, row->icon, 0, 0,
+					STATUS_VIEW_PADDING, y + STATUS_VIEW_PADDING, -1, -1,
+					GDK_RGB_DITHER_NONE, 0, 0);
+		gdk_draw_layout(area->window, area->style->text_gc[GTK_STATE_NORMAL],
+				STATUS_VIEW_ICON_SIZE + STATUS_VIEW_PADDING*2, y + STATUS_VIEW_PADDING,
+				row->layout);
+	}
+	return TRUE;
+}
+
+static void status_view_size_allocate(GtkWidget* area, GtkAllocation* allocation, STATUS_VIEW* view) {
+	if (allocation->width != view->width) {
+		/* wrapping changed. every row must be measured again */
+		guint n;
+		unbind_all(view);
+		view->width = allocation->width;
+		for(n = 0; n < view->rows->len; n++)
+			((STATUS_ROW*)g_ptr_array_index(view->rows, n))->height = -1;
+		invalidate_offsets(view, 0);
+	} else
+		/* only the page changed */
+		invalidate_offsets(view, view->rows->len);
+	update_offsets(view);
+}
+
+static void status_view_value_changed(GtkAdjustment* adjustment, STATUS_VIEW* view) {
+	gtk_widget_queue_draw(view->area);
+}
+
+static gboolean status_view_scroll(GtkWidget* area, GdkEventScroll* event, STATUS_VIEW* view) {
+	GtkAdjustment* adj = view->adjustment;
+	gdouble value = adj->value;
+
+	if (event->direction == GDK_SCROLL_UP) value -= adj->step_increment*3;
+	else if (event->direction == GDK_SCROLL_DOWN) value += adj->step_increment*3;
+	else return FALSE;
+	gtk_adjustment_set_value(adj, CLAMP(value, adj->lower, adj->upper - adj->page_size));
+	return TRUE;
+}
+
+static gboolean status_view_motion(GtkWidget* area, GdkEventMotion* event, STATUS_VIEW* view) {
+	gboolean hovering;
+
+	if (view->busy) return FALSE;
+	hovering = hit_link(view, (int)event->x, (int)event->y) != NULL;
+	if (hovering != view->hovering) {
+		view->hovering = hovering;
+		gdk_window_set_cursor(area->window, hovering ? view->hand_cursor : NULL);
+	}
+	return FALSE;
+}
+
+static gboolean status_view_button_release(GtkWidget* area, GdkEventButton* event, STATUS_VIEW* view) {
+	STATUS_LINK* link;
+	char* url;
+	char* user_id;
+
+	if (view->busy || event->button != 1 || !view->func) return FALSE;
+	link = hit_link(view, (int)event->x, (int)event->y);
+	if (!link) return FALSE;
+
+	/* the handler may clear the view */
+	url = g_strdup(link->link);
+	user_id = g_strdup(link->user_id);
+	view->func(view, url, user_id, view->user_data);
+	g_free(url);
+	g_free(user_id);
+	return TRUE;
+}
+
+static void status_view_destroy(GtkWidget* widget, STATUS_VIEW* view) {
+	guint n;
+	for(n = 0; n < view->rows->len; n++)
+		status_row_free((STATUS_ROW*)g_ptr_array_index(view->rows, n));
+	g_ptr_array_free(view->rows, TRUE);
+	while(view->pool) {
+		g_object_unref(view->pool->data);
+		view->pool = g_slist_delete_link(view->pool, view->pool);
+	}
+	gdk_cursor_unref(view->hand_cursor);
+	gdk_cursor_unref(view->watch_cursor);
+	g_free(view->offsets);
+	g_free(view);
+}
+
+/**
+ * view
+ */
+STATUS_VIEW* status_view_new(void) {
+	STATUS_VIEW* view = g_new0(STATUS_VIEW, 1);
+
+	view->rows = g_ptr_array_new();
+	view->offsets_size = 64;
+	view->offsets = g_new0(int, view->offsets_size);
+	view->offsets_stale = -1;
+	view->bound_last = -1;
+	view->hand_cursor = gdk_cursor_new(GDK_HAND2);
+	view->watch_cursor = gdk_cursor_new(GDK_WATCH);
+
+	view->adjustment = GTK_ADJUSTMENT(gtk_adjustment_new(0, 0, 0, 0, 0, 0));
+	view->area = gtk_drawing_area_new();
+	gtk_widget_add_events(view->area,
+			GDK_BUTTON_PRESS_MASK | GDK_BUTTON_RELEASE_MASK |
+			GDK_POINTER_MOTION_MASK | GDK_SCROLL_MASK);
+	view->scrollbar = gtk_vscrollbar_new(view->adjustment);
+	view->box = gtk_hbox_new(FALSE, 0);
+	gtk_box_pack_start(GTK_BOX(view->box), view->area, TRUE, TRUE, 0);
+	gtk_box_pack_start(GTK_BOX(view->box), view->scrollbar, FALSE, TRUE, 0);
+
+	g_signal_connect(view->area, "expose-event", G_CALLBACK(status_view_expose), view);
+	g_signal_connect(view->area, "size-allocate", G_CALLBACK(status_view_size_allocate), view);
+	g_signal_connect(view->area, "scroll-event", G_CALLBACK(status_view_scroll), view);
+	g_signal_connect(view->area, "motion-notify-event", G_CALLBACK(status_view_motion), view);
+	g_signal_connect(view->area, "button-release-event", G_CALLBACK(status_view_button_release), view);
+	g_signal_connect(view->adjustment, "value-changed", G_CALLBACK(status_view_value_changed), view);
+	g_signal_connect(view->box, "destroy", G_CALLBACK(status_view_destroy), view);
+	return view;
+}
+
+GtkWidget* status_view_get_widget(STATUS_VIEW* view) {
+	return view->box;
+}
+
+void status_view_set_link_func(STATUS_VIEW* view, STATUS_LINK_FUNC func, gpointer user_data) {
+	view->func = func;
+	view->user_data = user_data;
+}
+
+void status_view_set_busy(STATUS_VIEW* view, gboolean busy) {
+	view->busy = busy;
+	view->hovering = FALSE;
+	if (view->area->window)
+		gdk_window_set_cursor(view->area->window, busy ? view->watch_cursor : NULL);
+}
+
+/**
+ * the view owns the row from now on.
+ */
+void status_view_insert(STATUS_VIEW* view, int position, STATUS_ROW* row) {
+	GPtrArray* rows = view->rows;
+	gboolean above;
+	int top;
+
+	if (position < 0 || position > (int)rows->len) position = rows->len;
+	status_row_finish(row);
+	update_offsets_to(view, position);
+	top = (int)view->adjustment->value + view->scroll_shift;
+	above = top > 0 && view->offsets[position] < top;
+
+	g_ptr_array_add(rows, NULL);
+	memmove(&rows->pdata[position+1], &rows->pdata[position], (rows->len - position - 1)*sizeof(gpointer));
+	rows->pdata[position] = row;
+	if (position <= view->bound_first) {
+		view->bound_first++;
+		view->bound_last++;
+	} else
+	if (position <= view->bound_last)
+		view->bound_last++;
+
+	/**
+	 * keep the rows being read in place. offsets are made again and the
+	 * view is moved once for all the rows inserted, when it is drawn.
+	 */
+	invalidate_offsets(view, position);
+	if (above && view->width > 0) {
+		bind_row(view, position);
+		unbind_row(view, row);
+	}
+	if (above) view->scroll_shift += row_height(row);
+	gtk_widget_queue_draw(view->area);
+}
+
+void status_view_trim(STATUS_VIEW* view, int max_rows) {
+	if (max_rows < 0 || (int)view->rows->len <= max_rows) return;
+	while((int)view->rows->len > max_rows)
+		status_row_free((STATUS_ROW*)g_ptr_array_remove_index(view->rows, view->rows->len - 1));
+	if (view->bound_last >= (int)view->rows->len) view->bound_last = view->rows->len - 1;
+	/* rows left keep their offsets */
+	invalidate_offsets(view, view->rows->len);
+	update_offsets(view);
+	gtk_widget_queue_draw(view->area);
+}
+
+void status_view_clear(STATUS_VIEW* view) {
+	guint n;
+	for(n = 0; n < view->rows->len; n++)
+		status_row_free((STATUS_ROW*)g_ptr_array_index(view->rows, n));
+	g_ptr_array_set_size(view->rows, 0);
+	view->bound_first = 0;
+	view->bound_last = -1;
+	view->scroll_shift = 0;
+	invalidate_offsets(view, 0);
+	update_offsets(view);
+	gtk_adjustment_set_value(view->adjustment, 0);
+	gtk_widget_queue_draw(view->area);
+}
+
+int status_view_get_length(STATUS_VIEW* view) {
+	return view->rows->len;
+}
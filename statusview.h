@@ -0,0 +1,38 @@
+#ifndef _STATUSVIEW_H_
+#define _STATUSVIEW_H_
+
+#include <gtk/gtk.h>
+
+#define STATUS_VIEW_ICON_SIZE      32
+#define STATUS_VIEW_PADDING        6
+#define STATUS_VIEW_ESTIMATED_ROW  64
+#define STATUS_VIEW_MARGIN_ROWS    4
+
+/**
+ * virtualized timeline view
+ *
+ * rows are kept as plain text with link ranges. pango layouts are bound only
+ * to the rows in the viewport plus a margin and are recycled through a pool.
+ * a row is measured when it is shown for the first time, until then it
+ * counts with an estimated height.
+ */
+typedef struct _STATUS_ROW STATUS_ROW;
+typedef struct _STATUS_VIEW STATUS_VIEW;
+
+/* link is an url, "@name" or ">>status_id" like the links of the text view */
+typedef void (*STATUS_LINK_FUNC)(STATUS_VIEW* view, const char* link, const char* user_id, gpointer user_data);
+
+STATUS_ROW* status_row_new(GdkPixbuf* icon, const char* user_id, const char* name, const char* real, const char* date);
+void status_row_append(STATUS_ROW* row, const char* text, int len, const char* link, const char* user_id);
+void status_row_free(STATUS_ROW* row);
+
+STATUS_VIEW* status_view_new(void);
+GtkWidget* status_view_get_widget(STATUS_VIEW* view);
+void status_view_set_link_func(STATUS_VIEW* view, STATUS_LINK_FUNC func, gpointer user_data);
+void status_view_set_busy(STATUS_VIEW* view, gboolean busy);
+void status_view_insert(STATUS_VIEW* view, int position, STATUS_ROW* row);
+void status_view_trim(STATUS_VIEW* view, int max_rows);
+void status_view_clear(STATUS_VIEW* view);
+int status_view_get_length(STATUS_VIEW* view);
+
+#endif /* _STATUSVIEW_H_ */
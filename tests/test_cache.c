@@ -0,0 +1,85 @@
+/**
+ * cache loading an index which has a key twice.
+ *
+ * the last line of the key is the entry, and only its size may count
+ * towards max_size. counted twice, entries which fit are dropped when the
+ * cache is opened or when something is stored next.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <glib/gstdio.h>
+#include "cache.h"
+
+/* 600 + 300 bytes fit, 400 + 600 + 300 would not */
+#define MAX_SIZE 1000
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+static gboolean has_entry(CACHE* cache, const char* key) {
+	CACHE_ENTRY* entry = cache_lookup(cache, key);
+	gboolean ret = entry != NULL;
+	cache_entry_free(entry);
+	return ret;
+}
+
+static void remove_dir(const char* path) {
+	GDir* dir = g_dir_open(path, 0, NULL);
+	const gchar* name;
+
+	if (!dir) return;
+	while((name = g_dir_read_name(dir))) {
+		gchar* file = g_build_filename(path, name, NULL);
+		g_unlink(file);
+		g_free(file);
+	}
+	g_dir_close(dir);
+	g_rmdir(path);
+}
+
+int main(int argc, char* argv[]) {
+	gchar* name = g_strdup_printf("test_cache-%d", (int)getpid());
+	gchar* dir = g_build_filename(g_get_tmp_dir(), name, NULL);
+	gchar* index = g_build_filename(dir, "index", NULL);
+	const char* lines =
+		"200\t0\t100\t400\t\"a1\"\t\t\tfirst\n"
+		"200\t0\t300\t300\t\"b\"\t\t\tsecond\n"
+		"200\t0\t200\t600\t\"a2\"\t\t\tfirst\n";
+	CACHE* cache;
+	CACHE_ENTRY* entry;
+
+	g_thread_init(NULL);
+	remove_dir(dir);
+	g_mkdir_with_parents(dir, 0700);
+	g_file_set_contents(index, lines, -1, NULL);
+
+	cache = cache_open(dir, MAX_SIZE);
+	CHECK(cache != NULL);
+	if (!cache) goto leave;
+	CHECK(has_entry(cache, "second"));
+	entry = cache_lookup(cache, "first");
+	CHECK(entry != NULL);
+	if (entry) {
+		CHECK(entry->size == 600);
+		CHECK(!strcmp(entry->etag, "\"a2\""));
+		cache_entry_free(entry);
+	}
+
+	/* 100 bytes more still fit */
+	cache_store(cache, "third", 200, NULL, NULL, "text/plain", 0, "0123456789012345678901234567890123456789"
+		"012345678901234567890123456789012345678901234567890123456789", 100);
+	CHECK(has_entry(cache, "first"));
+	CHECK(has_entry(cache, "second"));
+	CHECK(has_entry(cache, "third"));
+	cache_close(cache);
+
+leave:
+	remove_dir(dir);
+	g_free(index);
+	g_free(dir);
+	g_free(name);
+	printf("test_cache: %s\n", failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * status_index against the rows rendered from it.
+ *
+ * install_timeline renders a status at the position status_index_insert
+ * gave it and skips those given -1. the rows here are put in the same way,
+ * and must stay the statuses of the index in its order whatever page goes
+ * in, duplicates and pages out of order included.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "statustime.h"
+
+#define MAX_ROWS 64
+
+typedef struct _PAGE_STATUS {
+	const char* status_id;
+	time_t time;
+} PAGE_STATUS;
+
+static const char* rows[MAX_ROWS];
+static int nrows = 0;
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+static void install_page(STATUS_INDEX* index, PAGE_STATUS* page, int count, gboolean incremental) {
+	int n, pos;
+
+	if (!incremental) {
+		status_index_clear(index);
+		nrows = 0;
+	}
+	for(n = 0; n < count; n++) {
+		pos = status_index_insert(index, page[n].status_id, page[n].time);
+		if (pos < 0) continue;
+		memmove(rows + pos + 1, rows + pos, (nrows - pos)*sizeof(char*));
+		rows[pos] = page[n].status_id;
+		nrows++;
+	}
+}
+
+static void check_rows(STATUS_INDEX* index, const char** expected, int count) {
+	int n;
+
+	CHECK(nrows == count);
+	CHECK((int)status_index_length(index) == nrows);
+	for(n = 0; n < nrows && n < count; n++) {
+		CHECK(!strcmp(rows[n], status_index_id(index, n)));
+		CHECK(!strcmp(rows[n], expected[n]));
+	}
+}
+
+int main(int argc, char* argv[]) {
+	STATUS_INDEX* index = status_index_new();
+
+	/* the same status twice in one page, as a retweet and its original can be */
+	PAGE_STATUS full[] = {
+		{ "105", 1050 }, { "104", 1040 }, { "104", 1040 }, { "102", 1020 }, { "101", 1010 },
+	};
+	const char* after_full[] = { "105", "104", "102", "101" };
+
+	/* new ones on top, one shown already, one older and one in between */
+	PAGE_STATUS next[] = {
+		{ "107", 1070 }, { "106", 1060 }, { "104", 1040 }, { "103", 1030 }, { "100", 1000 },
+	};
+	const char* after_next[] = { "107", "106", "105", "104", "103", "102", "101", "100" };
+
+	/* a page out of order, as merged timelines of the same second can be */
+	PAGE_STATUS unordered[] = {
+		{ "201", 2010 }, { "203", 2030 }, { "202", 2020 }, { "203", 2030 },
+	};
+	const char* after_unordered[] = { "203", "202", "201" };
+
+	install_page(index, full, G_N_ELEMENTS(full), FALSE);
+	check_rows(index, after_full, G_N_ELEMENTS(after_full));
+
+	install_page(index, next, G_N_ELEMENTS(next), TRUE);
+	check_rows(index, after_next, G_N_ELEMENTS(after_next));
+
+	install_page(index, unordered, G_N_ELEMENTS(unordered), FALSE);
+	check_rows(index, after_unordered, G_N_ELEMENTS(after_unordered));
+
+	status_index_free(index);
+	printf("test_statusindex: %s\n", failures ? "FAILED" : "ok");
+	return failures ? 1 : 0;
+}